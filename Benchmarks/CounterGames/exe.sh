@@ -1,400 +1 @@
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_1.ltlf -p part_1.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_2.ltlf -p part_1.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_3.ltlf -p part_1.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_4.ltlf -p part_1.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_5.ltlf -p part_1.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_6.ltlf -p part_1.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_7.ltlf -p part_1.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_8.ltlf -p part_1.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_9.ltlf -p part_1.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_10.ltlf -p part_1.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_1.ltlf -p part_2.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_2.ltlf -p part_2.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_3.ltlf -p part_2.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_4.ltlf -p part_2.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_5.ltlf -p part_2.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_6.ltlf -p part_2.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_7.ltlf -p part_2.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_8.ltlf -p part_2.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_9.ltlf -p part_2.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_10.ltlf -p part_2.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_1.ltlf -p part_3.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_2.ltlf -p part_3.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_3.ltlf -p part_3.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_4.ltlf -p part_3.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_5.ltlf -p part_3.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_6.ltlf -p part_3.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_7.ltlf -p part_3.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_8.ltlf -p part_3.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_9.ltlf -p part_3.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_10.ltlf -p part_3.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_1.ltlf -p part_4.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_2.ltlf -p part_4.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_3.ltlf -p part_4.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_4.ltlf -p part_4.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_5.ltlf -p part_4.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_6.ltlf -p part_4.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_7.ltlf -p part_4.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_8.ltlf -p part_4.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_9.ltlf -p part_4.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_10.ltlf -p part_4.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_1.ltlf -p part_5.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_2.ltlf -p part_5.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_3.ltlf -p part_5.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_4.ltlf -p part_5.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_5.ltlf -p part_5.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_6.ltlf -p part_5.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_7.ltlf -p part_5.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_8.ltlf -p part_5.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_9.ltlf -p part_5.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_10.ltlf -p part_5.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_1.ltlf -p part_6.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_2.ltlf -p part_6.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_3.ltlf -p part_6.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_4.ltlf -p part_6.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_5.ltlf -p part_6.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_6.ltlf -p part_6.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_7.ltlf -p part_6.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_8.ltlf -p part_6.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_9.ltlf -p part_6.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_10.ltlf -p part_6.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_1.ltlf -p part_7.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_2.ltlf -p part_7.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_3.ltlf -p part_7.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_4.ltlf -p part_7.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_5.ltlf -p part_7.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_6.ltlf -p part_7.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_7.ltlf -p part_7.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_8.ltlf -p part_7.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_9.ltlf -p part_7.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_10.ltlf -p part_7.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_1.ltlf -p part_8.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_2.ltlf -p part_8.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_3.ltlf -p part_8.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_4.ltlf -p part_8.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_5.ltlf -p part_8.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_6.ltlf -p part_8.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_7.ltlf -p part_8.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_8.ltlf -p part_8.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_9.ltlf -p part_8.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_10.ltlf -p part_8.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_1.ltlf -p part_9.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_2.ltlf -p part_9.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_3.ltlf -p part_9.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_4.ltlf -p part_9.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_5.ltlf -p part_9.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_6.ltlf -p part_9.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_7.ltlf -p part_9.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_8.ltlf -p part_9.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_9.ltlf -p part_9.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_10.ltlf -p part_9.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_1.ltlf -p part_10.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_2.ltlf -p part_10.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_3.ltlf -p part_10.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_4.ltlf -p part_10.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_5.ltlf -p part_10.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_6.ltlf -p part_10.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_7.ltlf -p part_10.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_8.ltlf -p part_10.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_9.ltlf -p part_10.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_10.ltlf -p part_10.part -t 1 -f outfl_1.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_1.ltlf -p part_1.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_2.ltlf -p part_1.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_3.ltlf -p part_1.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_4.ltlf -p part_1.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_5.ltlf -p part_1.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_6.ltlf -p part_1.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_7.ltlf -p part_1.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_8.ltlf -p part_1.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_9.ltlf -p part_1.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_10.ltlf -p part_1.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_1.ltlf -p part_2.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_2.ltlf -p part_2.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_3.ltlf -p part_2.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_4.ltlf -p part_2.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_5.ltlf -p part_2.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_6.ltlf -p part_2.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_7.ltlf -p part_2.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_8.ltlf -p part_2.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_9.ltlf -p part_2.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_10.ltlf -p part_2.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_1.ltlf -p part_3.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_2.ltlf -p part_3.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_3.ltlf -p part_3.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_4.ltlf -p part_3.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_5.ltlf -p part_3.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_6.ltlf -p part_3.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_7.ltlf -p part_3.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_8.ltlf -p part_3.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_9.ltlf -p part_3.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_10.ltlf -p part_3.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_1.ltlf -p part_4.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_2.ltlf -p part_4.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_3.ltlf -p part_4.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_4.ltlf -p part_4.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_5.ltlf -p part_4.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_6.ltlf -p part_4.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_7.ltlf -p part_4.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_8.ltlf -p part_4.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_9.ltlf -p part_4.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_10.ltlf -p part_4.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_1.ltlf -p part_5.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_2.ltlf -p part_5.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_3.ltlf -p part_5.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_4.ltlf -p part_5.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_5.ltlf -p part_5.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_6.ltlf -p part_5.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_7.ltlf -p part_5.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_8.ltlf -p part_5.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_9.ltlf -p part_5.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_10.ltlf -p part_5.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_1.ltlf -p part_6.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_2.ltlf -p part_6.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_3.ltlf -p part_6.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_4.ltlf -p part_6.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_5.ltlf -p part_6.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_6.ltlf -p part_6.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_7.ltlf -p part_6.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_8.ltlf -p part_6.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_9.ltlf -p part_6.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_10.ltlf -p part_6.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_1.ltlf -p part_7.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_2.ltlf -p part_7.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_3.ltlf -p part_7.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_4.ltlf -p part_7.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_5.ltlf -p part_7.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_6.ltlf -p part_7.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_7.ltlf -p part_7.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_8.ltlf -p part_7.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_9.ltlf -p part_7.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_10.ltlf -p part_7.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_1.ltlf -p part_8.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_2.ltlf -p part_8.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_3.ltlf -p part_8.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_4.ltlf -p part_8.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_5.ltlf -p part_8.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_6.ltlf -p part_8.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_7.ltlf -p part_8.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_8.ltlf -p part_8.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_9.ltlf -p part_8.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_10.ltlf -p part_8.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_1.ltlf -p part_9.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_2.ltlf -p part_9.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_3.ltlf -p part_9.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_4.ltlf -p part_9.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_5.ltlf -p part_9.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_6.ltlf -p part_9.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_7.ltlf -p part_9.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_8.ltlf -p part_9.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_9.ltlf -p part_9.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_10.ltlf -p part_9.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_1.ltlf -p part_10.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_2.ltlf -p part_10.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_3.ltlf -p part_10.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_4.ltlf -p part_10.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_5.ltlf -p part_10.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_6.ltlf -p part_10.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_7.ltlf -p part_10.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_8.ltlf -p part_10.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_9.ltlf -p part_10.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_10.ltlf -p part_10.part -t 2 -f outfl_2.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_1.ltlf -p part_1.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_2.ltlf -p part_1.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_3.ltlf -p part_1.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_4.ltlf -p part_1.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_5.ltlf -p part_1.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_6.ltlf -p part_1.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_7.ltlf -p part_1.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_8.ltlf -p part_1.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_9.ltlf -p part_1.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_10.ltlf -p part_1.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_1.ltlf -p part_2.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_2.ltlf -p part_2.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_3.ltlf -p part_2.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_4.ltlf -p part_2.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_5.ltlf -p part_2.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_6.ltlf -p part_2.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_7.ltlf -p part_2.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_8.ltlf -p part_2.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_9.ltlf -p part_2.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_10.ltlf -p part_2.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_1.ltlf -p part_3.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_2.ltlf -p part_3.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_3.ltlf -p part_3.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_4.ltlf -p part_3.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_5.ltlf -p part_3.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_6.ltlf -p part_3.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_7.ltlf -p part_3.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_8.ltlf -p part_3.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_9.ltlf -p part_3.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_10.ltlf -p part_3.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_1.ltlf -p part_4.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_2.ltlf -p part_4.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_3.ltlf -p part_4.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_4.ltlf -p part_4.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_5.ltlf -p part_4.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_6.ltlf -p part_4.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_7.ltlf -p part_4.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_8.ltlf -p part_4.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_9.ltlf -p part_4.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_10.ltlf -p part_4.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_1.ltlf -p part_5.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_2.ltlf -p part_5.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_3.ltlf -p part_5.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_4.ltlf -p part_5.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_5.ltlf -p part_5.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_6.ltlf -p part_5.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_7.ltlf -p part_5.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_8.ltlf -p part_5.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_9.ltlf -p part_5.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_10.ltlf -p part_5.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_1.ltlf -p part_6.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_2.ltlf -p part_6.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_3.ltlf -p part_6.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_4.ltlf -p part_6.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_5.ltlf -p part_6.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_6.ltlf -p part_6.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_7.ltlf -p part_6.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_8.ltlf -p part_6.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_9.ltlf -p part_6.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_10.ltlf -p part_6.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_1.ltlf -p part_7.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_2.ltlf -p part_7.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_3.ltlf -p part_7.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_4.ltlf -p part_7.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_5.ltlf -p part_7.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_6.ltlf -p part_7.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_7.ltlf -p part_7.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_8.ltlf -p part_7.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_9.ltlf -p part_7.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_10.ltlf -p part_7.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_1.ltlf -p part_8.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_2.ltlf -p part_8.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_3.ltlf -p part_8.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_4.ltlf -p part_8.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_5.ltlf -p part_8.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_6.ltlf -p part_8.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_7.ltlf -p part_8.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_8.ltlf -p part_8.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_9.ltlf -p part_8.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_10.ltlf -p part_8.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_1.ltlf -p part_9.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_2.ltlf -p part_9.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_3.ltlf -p part_9.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_4.ltlf -p part_9.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_5.ltlf -p part_9.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_6.ltlf -p part_9.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_7.ltlf -p part_9.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_8.ltlf -p part_9.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_9.ltlf -p part_9.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_10.ltlf -p part_9.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_1.ltlf -p part_10.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_2.ltlf -p part_10.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_3.ltlf -p part_10.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_4.ltlf -p part_10.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_5.ltlf -p part_10.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_6.ltlf -p part_10.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_7.ltlf -p part_10.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_8.ltlf -p part_10.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_9.ltlf -p part_10.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_10.ltlf -p part_10.part -t 3 -f outfl_3.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_1.ltlf -p part_1.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_2.ltlf -p part_1.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_3.ltlf -p part_1.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_4.ltlf -p part_1.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_5.ltlf -p part_1.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_6.ltlf -p part_1.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_7.ltlf -p part_1.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_8.ltlf -p part_1.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_9.ltlf -p part_1.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_1.ltlf -e env_10.ltlf -p part_1.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_1.ltlf -p part_2.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_2.ltlf -p part_2.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_3.ltlf -p part_2.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_4.ltlf -p part_2.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_5.ltlf -p part_2.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_6.ltlf -p part_2.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_7.ltlf -p part_2.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_8.ltlf -p part_2.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_9.ltlf -p part_2.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_2.ltlf -e env_10.ltlf -p part_2.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_1.ltlf -p part_3.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_2.ltlf -p part_3.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_3.ltlf -p part_3.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_4.ltlf -p part_3.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_5.ltlf -p part_3.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_6.ltlf -p part_3.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_7.ltlf -p part_3.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_8.ltlf -p part_3.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_9.ltlf -p part_3.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_3.ltlf -e env_10.ltlf -p part_3.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_1.ltlf -p part_4.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_2.ltlf -p part_4.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_3.ltlf -p part_4.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_4.ltlf -p part_4.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_5.ltlf -p part_4.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_6.ltlf -p part_4.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_7.ltlf -p part_4.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_8.ltlf -p part_4.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_9.ltlf -p part_4.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_4.ltlf -e env_10.ltlf -p part_4.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_1.ltlf -p part_5.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_2.ltlf -p part_5.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_3.ltlf -p part_5.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_4.ltlf -p part_5.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_5.ltlf -p part_5.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_6.ltlf -p part_5.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_7.ltlf -p part_5.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_8.ltlf -p part_5.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_9.ltlf -p part_5.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_5.ltlf -e env_10.ltlf -p part_5.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_1.ltlf -p part_6.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_2.ltlf -p part_6.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_3.ltlf -p part_6.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_4.ltlf -p part_6.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_5.ltlf -p part_6.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_6.ltlf -p part_6.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_7.ltlf -p part_6.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_8.ltlf -p part_6.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_9.ltlf -p part_6.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_6.ltlf -e env_10.ltlf -p part_6.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_1.ltlf -p part_7.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_2.ltlf -p part_7.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_3.ltlf -p part_7.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_4.ltlf -p part_7.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_5.ltlf -p part_7.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_6.ltlf -p part_7.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_7.ltlf -p part_7.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_8.ltlf -p part_7.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_9.ltlf -p part_7.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_7.ltlf -e env_10.ltlf -p part_7.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_1.ltlf -p part_8.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_2.ltlf -p part_8.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_3.ltlf -p part_8.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_4.ltlf -p part_8.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_5.ltlf -p part_8.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_6.ltlf -p part_8.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_7.ltlf -p part_8.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_8.ltlf -p part_8.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_9.ltlf -p part_8.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_8.ltlf -e env_10.ltlf -p part_8.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_1.ltlf -p part_9.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_2.ltlf -p part_9.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_3.ltlf -p part_9.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_4.ltlf -p part_9.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_5.ltlf -p part_9.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_6.ltlf -p part_9.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_7.ltlf -p part_9.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_8.ltlf -p part_9.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_9.ltlf -p part_9.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_9.ltlf -e env_10.ltlf -p part_9.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_1.ltlf -p part_10.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_2.ltlf -p part_10.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_3.ltlf -p part_10.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_4.ltlf -p part_10.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_5.ltlf -p part_10.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_6.ltlf -p part_10.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_7.ltlf -p part_10.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_8.ltlf -p part_10.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_9.ltlf -p part_10.part -t 4 -f outfl_4.csv -s 0  ;
-timeout 1000 ./../../build/bin/BeSyft -a goal_10.ltlf -e env_10.ltlf -p part_10.part -t 4 -f outfl_4.csv -s 0
\ No newline at end of file
+./../../build/bin/BeSyft --batch batch.manifest --timeout 1000
@@ -19,8 +19,12 @@ outfl_1 = pd.read_csv(r"outfl_1.csv", header=None)
 outfl_2 = pd.read_csv(r"outfl_2.csv", header=None)
 outfl_3 = pd.read_csv(r"outfl_3.csv", header=None)
 outfl_4 = pd.read_csv(r"outfl_4.csv", header=None)
+outfl_5 = pd.read_csv(r"outfl_5.csv", header=None)
+outfl_6 = pd.read_csv(r"outfl_6.csv", header=None)
+outfl_7 = pd.read_csv(r"outfl_7.csv", header=None)
+outfl_8 = pd.read_csv(r"outfl_8.csv", header=None)
 
-dfs = [outfl_1, outfl_2, outfl_3, outfl_4]
+dfs = [outfl_1, outfl_2, outfl_3, outfl_4, outfl_5, outfl_6, outfl_7, outfl_8]
 
 for df in dfs: df.columns = HEADER
 
@@ -74,6 +78,33 @@ for i in range(1, MAX_GOALS+1):
     plt.legend()
     plt.show()
 
+# plots comparison of symbolic and explicit-state reactive synthesis
+dfs = [outfl_4, outfl_5, outfl_6, outfl_7, outfl_8]
+for i in range(1, MAX_GOALS+1):
+    bench_df = pd.DataFrame()
+    bench_df["K"] = [i for i in range(1, MAX_ENVS+1)]
+    for df in dfs:
+        goal_df = df.iloc[:,[1,8]]
+        goal_df = (goal_df.loc[goal_df['Goal'] == "goal_"+str(i)+".ltlf"])
+        bench_df[df.iloc[0].tolist()[0]] = pad(goal_df.iloc[:,[1]]["Run Time (s)"], MAX_ENVS, TIMEOUT).values
+    fig = plt.subplots()
+
+    plt.plot(bench_df["Adversarial Synthesizer"], label="Symbolic Reactive Synthesis", color = "red", marker = 'o')
+    plt.plot(bench_df["Hybrid Adversarial Synthesizer"], label="Hybrid Reactive Synthesis", color = "purple", marker = 'o')
+    plt.plot(bench_df["Bit-Parallel Adversarial Synthesizer"], label="Bit-Parallel Reactive Synthesis", color = "orange", marker = 'o')
+    plt.plot(bench_df["On-the-fly Adversarial Synthesizer"], label="On-the-fly Reactive Synthesis", color = "blue", marker = 'o')
+    plt.plot(bench_df["Antichain Adversarial Synthesizer"], label="Antichain Reactive Synthesis", color = "brown", marker = 'o')
+    
+    plt.yscale("log")
+    plt.xlabel("Environment requests (K)")
+    plt.ylabel("Running time (s)")
+    plt.title("Symbolic vs explicit-state and compositional reactive synthesis on "+str(i)+"-bits counter games")
+    plt.xticks(np.arange(MAX_ENVS), np.arange(1, MAX_ENVS+1))
+    plt.yticks([0.001, 0.01, 0.1, 1, 10, 100, 1000], [0.001, 0.01, 0.1, 1, 10, 100, 1000])
+
+    plt.legend()
+    plt.show()
+
 # plots the stacked bar plots
 # determine hardest instance solved
 dfs = [outfl_1, outfl_2, outfl_3]
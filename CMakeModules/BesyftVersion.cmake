@@ -0,0 +1,39 @@
+# Writes the header defining BESYFT_VERSION, which identifies the build in the
+# keys of the result store.
+#
+# Usage of this script as follows:
+#
+# cmake -DSOURCE_DIR=<source tree> -DOUTPUT=<header> -P BesyftVersion.cmake
+#
+# The version is the output of git describe, followed by a hash of the sources,
+# so that builds from different uncommitted edits differ too. The header is
+# only rewritten when the version changes, so that unchanged builds do not
+# recompile main.cpp.
+
+execute_process(COMMAND git describe --always --dirty
+                WORKING_DIRECTORY ${SOURCE_DIR}
+                OUTPUT_VARIABLE BESYFT_DESCRIBE
+                OUTPUT_STRIP_TRAILING_WHITESPACE
+                ERROR_QUIET)
+if(NOT BESYFT_DESCRIBE)
+	set(BESYFT_DESCRIBE "unknown")
+endif()
+
+file(GLOB_RECURSE BESYFT_SOURCES
+     ${SOURCE_DIR}/src/*.cpp ${SOURCE_DIR}/src/*.h ${SOURCE_DIR}/src/*.hpp ${SOURCE_DIR}/src/*.hh)
+list(SORT BESYFT_SOURCES)
+set(BESYFT_SOURCE_HASHES "")
+foreach(BESYFT_SOURCE ${BESYFT_SOURCES})
+	file(SHA256 ${BESYFT_SOURCE} BESYFT_SOURCE_HASH)
+	string(APPEND BESYFT_SOURCE_HASHES "${BESYFT_SOURCE} ${BESYFT_SOURCE_HASH}\n")
+endforeach()
+string(SHA256 BESYFT_SOURCES_HASH "${BESYFT_SOURCE_HASHES}")
+string(SUBSTRING ${BESYFT_SOURCES_HASH} 0 16 BESYFT_SOURCES_HASH)
+
+set(BESYFT_VERSION_HEADER "#define BESYFT_VERSION \"${BESYFT_DESCRIBE}-${BESYFT_SOURCES_HASH}\"\n")
+if(EXISTS ${OUTPUT})
+	file(READ ${OUTPUT} BESYFT_OLD_VERSION_HEADER)
+endif()
+if(NOT BESYFT_VERSION_HEADER STREQUAL BESYFT_OLD_VERSION_HEADER)
+	file(WRITE ${OUTPUT} "${BESYFT_VERSION_HEADER}")
+endif()
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+# Saves the best-effort strategies of small counter games as ASCII (.aag) and
+# binary (.aig) AIGER circuits. Checks that each ASCII circuit is well formed,
+# with the inputs and outputs of the partition, and that the binary circuit
+# decodes to the same circuit.
+#
+# Usage: ./check-aiger.py [path to BeSyft]
+# Exits with status 1 if some circuit is malformed or the two formats differ.
+
+import os
+import subprocess
+import sys
+import tempfile
+
+BESYFT = os.path.realpath(sys.argv[1] if len(sys.argv) > 1 else "build/bin/BeSyft")
+GOALS = [1, 2, 3]
+ENVIRONMENTS = [1, 2]
+
+
+def read_partition(filename):
+    """Returns the inputs and the outputs of a partition file."""
+    inputs, outputs = [], []
+    with open(filename) as partition:
+        for line in partition:
+            if line.startswith(".inputs:"):
+                inputs = line.split(":", 1)[1].split()
+            elif line.startswith(".outputs:"):
+                outputs = line.split(":", 1)[1].split()
+    return inputs, outputs
+
+
+def read_symbols(lines):
+    """Returns the names of the inputs, latches and outputs in a symbol table."""
+    symbols = {"i": {}, "l": {}, "o": {}}
+    for line in lines:
+        if line == "c":
+            break
+        kind, name = line[0], line.split(" ", 1)[1]
+        symbols[kind][int(line[1:].split(" ", 1)[0])] = name
+    return [[symbols[kind][i] for i in sorted(symbols[kind])] for kind in "ilo"]
+
+
+def read_ascii(filename):
+    """Parses an ASCII AIGER file and checks that it is well formed."""
+    with open(filename) as circuit:
+        lines = circuit.read().split("\n")
+    header = lines[0].split()
+    assert header[0] == "aag", "not an ASCII AIGER file"
+    m, i, l, o, a = map(int, header[1:])
+    assert m == i + l + a, "maximum variable index is not I + L + A"
+    position = 1
+    for k in range(i):
+        assert int(lines[position + k]) == 2 * (k + 1), "inputs are not numbered in order"
+    position += i
+    latches = []
+    for k in range(l):
+        fields = list(map(int, lines[position + k].split()))
+        assert fields[0] == 2 * (i + k + 1), "latches are not numbered in order"
+        latches.append((fields[1], fields[2] if len(fields) > 2 else 0))
+    position += l
+    outputs = [int(lines[position + k]) for k in range(o)]
+    position += o
+    gates = []
+    for k in range(a):
+        lhs, left, right = map(int, lines[position + k].split())
+        assert lhs == 2 * (i + l + k + 1), "AND gates are not numbered in order"
+        assert lhs > left >= right, "AND gate operands are not ordered"
+        gates.append((left, right))
+    position += a
+    for literal in [next for next, _ in latches] + outputs:
+        assert literal <= 2 * m + 1, "literal out of range"
+    return (i, l, o, a), latches, outputs, gates, read_symbols(lines[position:])
+
+
+def read_binary(filename):
+    """Parses a binary AIGER file."""
+    with open(filename, "rb") as circuit:
+        data = circuit.read()
+
+    def read_line(position):
+        end = data.index(b"\n", position)
+        return data[position:end].decode(), end + 1
+
+    def read_unsigned(position):
+        value, shift = 0, 0
+        while True:
+            byte = data[position]
+            position += 1
+            value |= (byte & 0x7f) << shift
+            if byte & 0x80 == 0:
+                return value, position
+            shift += 7
+
+    line, position = read_line(0)
+    header = line.split()
+    assert header[0] == "aig", "not a binary AIGER file"
+    m, i, l, o, a = map(int, header[1:])
+    latches = []
+    for _ in range(l):
+        line, position = read_line(position)
+        fields = list(map(int, line.split()))
+        latches.append((fields[0], fields[1] if len(fields) > 1 else 0))
+    outputs = []
+    for _ in range(o):
+        line, position = read_line(position)
+        outputs.append(int(line))
+    gates = []
+    for k in range(a):
+        lhs = 2 * (i + l + k + 1)
+        delta0, position = read_unsigned(position)
+        delta1, position = read_unsigned(position)
+        gates.append((lhs - delta0, lhs - delta0 - delta1))
+    symbols = data[position:].decode().split("\n")
+    return (i, l, o, a), latches, outputs, gates, read_symbols(symbols)
+
+
+def main():
+    os.chdir(os.path.join(os.path.dirname(os.path.realpath(__file__)), "Benchmarks", "CounterGames"))
+    failures = 0
+    with tempfile.TemporaryDirectory() as directory:
+        for goal in GOALS:
+            for environment in ENVIRONMENTS:
+                for starting in [0, 1]:
+                    instance = "goal_%d env_%d -s %d" % (goal, environment, starting)
+                    circuits = {}
+                    try:
+                        for extension in ["aag", "aig"]:
+                            filename = os.path.join(directory, "strategy." + extension)
+                            subprocess.run([BESYFT, "-a", "goal_%d.ltlf" % goal, "-e", "env_%d.ltlf" % environment,
+                                            "-p", "part_%d.part" % goal, "-s", str(starting), "-t", "3",
+                                            "--aiger", filename],
+                                           stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, check=True)
+                            circuits[extension] = (read_ascii if extension == "aag" else read_binary)(filename)
+                        inputs, outputs = read_partition("part_%d.part" % goal)
+                        symbols = circuits["aag"][4]
+                        assert symbols[0] == inputs, "inputs %s instead of %s" % (symbols[0], inputs)
+                        assert symbols[2] == outputs, "outputs %s instead of %s" % (symbols[2], outputs)
+                        assert circuits["aag"] == circuits["aig"], "binary and ASCII circuits differ"
+                    except (AssertionError, subprocess.CalledProcessError, ValueError, IndexError, KeyError) as error:
+                        print("FAIL %s: %s" % (instance, error))
+                        failures += 1
+                        continue
+                    print("ok   %s: %d AND gates, %d latches" % (instance, circuits["aag"][0][3], circuits["aag"][0][1]))
+    if failures > 0:
+        print("%d circuits failed" % failures)
+        sys.exit(1)
+    print("All circuits are well formed")
+
+
+if __name__ == "__main__":
+    main()
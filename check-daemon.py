@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+# Sends the daemon, on stdin, the requests of small counter games: a goal, a
+# conjunct added to it with add_goal, an invalid request and the whole goal
+# from scratch with its strategy. Checks that every request gets one response
+# with its id, that the invalid one gets an error, that the session caches more
+# DFAs as it goes, and that add_goal and the fresh request agree.
+#
+# Usage: ./check-daemon.py [path to BeSyft]
+# Exits with status 1 if some response is missing or wrong.
+
+import importlib.util
+import os
+import subprocess
+import sys
+
+BESYFT = os.path.realpath(sys.argv[1] if len(sys.argv) > 1 else "build/bin/BeSyft")
+GOALS = [1, 2, 3]
+ENVIRONMENTS = [1, 2]
+
+# The conjunct splitting and the daemon runs of check-session.py
+ROOT = os.path.dirname(os.path.realpath(__file__))
+spec = importlib.util.spec_from_file_location("check_session", os.path.join(ROOT, "check-session.py"))
+check_session = importlib.util.module_from_spec(spec)
+spec.loader.exec_module(check_session)
+check_session.BESYFT = BESYFT
+
+
+def conjunction(conjuncts):
+    """Returns the conjunction of formulas."""
+    return " & ".join("(%s)" % conjunct for conjunct in conjuncts)
+
+
+def check(requests, responses):
+    """Checks the responses of the daemon to the requests of one instance."""
+    assert [response.get("id") for response in responses] == [request["id"] for request in requests], \
+        "%d responses to %d requests, or their ids differ" % (len(responses), len(requests))
+    goal, added, invalid, fresh = responses
+    for response in [goal, added, fresh]:
+        assert "error" not in response, response["error"] if "error" in response else ""
+        assert response["verdict"] in ["Adv", "Coop", "Unr"], "verdict %s" % response["verdict"]
+        assert len(response["times"]) > 0, "no running times"
+        assert abs(sum(response["times"]) - response["total"]) < 1e-3 * max(1, response["total"]), \
+            "total %s is not the sum of %s" % (response["total"], response["times"])
+    assert "error" in invalid and "verdict" not in invalid, "invalid request answered with %s" % invalid
+    assert goal["cached_dfas"] <= added["cached_dfas"] <= fresh["cached_dfas"], \
+        "cached DFAs %d, %d, %d" % (goal["cached_dfas"], added["cached_dfas"], fresh["cached_dfas"])
+    assert added["verdict"] == fresh["verdict"], \
+        "add_goal gives %s, from scratch %s" % (added["verdict"], fresh["verdict"])
+    assert "strategy" not in goal and "strategy" not in added, "strategy not requested"
+    if fresh["verdict"] == "Unr":
+        assert fresh["strategy"] is None, "strategy of an unrealizable goal"
+    else:
+        assert fresh["strategy"].startswith("aag "), "strategy is not an ASCII AIGER circuit"
+    return added["verdict"]
+
+
+def main():
+    os.chdir(os.path.join(ROOT, "Benchmarks", "CounterGames"))
+    failures = 0
+    for goal in GOALS:
+        with open("goal_%d.ltlf" % goal) as goal_file:
+            goal_conjuncts = check_session.conjuncts(goal_file.read().strip())
+        half = len(goal_conjuncts) // 2
+        for environment in ENVIRONMENTS:
+            with open("env_%d.ltlf" % environment) as environment_file:
+                assumption = environment_file.read().strip()
+            for starting in ["agent", "environment"]:
+                instance = "goal_%d env_%d %s" % (goal, environment, starting)
+                problem = {"partition": "part_%d.part" % goal, "starting_player": starting}
+                requests = [
+                    dict(problem, id=1, goal=conjunction(goal_conjuncts[:half]), assumption=assumption),
+                    dict(problem, id=2, add_goal=conjunction(goal_conjuncts[half:])),
+                    dict(problem, id="invalid", goal="F(add)", starting_player="nobody"),
+                    dict(problem, id=4, goal=conjunction(goal_conjuncts), assumption=assumption, strategy=True),
+                ]
+                try:
+                    verdict = check(requests, check_session.solve(requests))
+                except (AssertionError, subprocess.CalledProcessError, ValueError, KeyError, TypeError) as error:
+                    print("FAIL %s: %s" % (instance, error))
+                    failures += 1
+                    continue
+                print("ok   %s: %s" % (instance, verdict))
+    if failures > 0:
+        print("%d daemon runs failed" % failures)
+        sys.exit(1)
+    print("All daemon responses are correct")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+# Saves the best-effort strategies of small counter games both as a minimal
+# Mealy machine table (--mealy) and as an ASCII AIGER circuit (--aiger), runs
+# the two on the same random traces and checks that they give the same outputs.
+#
+# Usage: ./check-mealy.py [path to BeSyft]
+# Exits with status 1 if the table and the circuit disagree or some run fails.
+
+import importlib.util
+import os
+import random
+import re
+import subprocess
+import sys
+import tempfile
+
+BESYFT = os.path.realpath(sys.argv[1] if len(sys.argv) > 1 else "build/bin/BeSyft")
+GOALS = [1, 2, 3]
+ENVIRONMENTS = [1, 2]
+TRACES = 100
+TRACE_LENGTH = 40
+
+# The AIGER parser of check-aiger.py
+ROOT = os.path.dirname(os.path.realpath(__file__))
+spec = importlib.util.spec_from_file_location("check_aiger", os.path.join(ROOT, "check-aiger.py"))
+check_aiger = importlib.util.module_from_spec(spec)
+spec.loader.exec_module(check_aiger)
+
+
+def read_mealy(filename):
+    """Returns the labels, the letter decision diagram and the table of a Mealy machine header."""
+    with open(filename) as header:
+        text = header.read()
+
+    def labels(title):
+        line = re.search(r"/\* %s:(.*) \*/" % title, text).group(1)
+        return [field.split("=", 1)[1] for field in line.split()]
+
+    letter_count = int(re.search(r"#define BESYFT_LETTER_COUNT (\d+)", text).group(1))
+    nodes_text = text[text.index("besyft_letter_nodes[] = {"):]
+    nodes_text = nodes_text[:nodes_text.index("};")]
+    nodes = [tuple(map(int, node)) for node in re.findall(r"\{(-?\d+), (\d+), (\d+)\}", nodes_text)]
+    table_text = text[text.index("besyft_mealy[BESYFT_STATE_COUNT]"):]
+    entries = [(int(next), int(output)) for next, output in re.findall(r"\{(\d+), (\d+)ull\}", table_text)]
+    table = [entries[s:s + letter_count] for s in range(0, len(entries), letter_count)]
+    return labels("Input word bits"), labels("Output letter bits"), nodes, table
+
+
+def run_mealy(machine, trace):
+    """Returns the outputs of a Mealy machine on a trace of input valuations."""
+    input_labels, output_labels, nodes, table = machine
+    state, outputs = 0, []
+    for valuation in trace:
+        word = sum(valuation[label] << i for i, label in enumerate(input_labels))
+        node = 0
+        while nodes[node][0] >= 0:
+            node = nodes[node][1] if (word >> nodes[node][0]) & 1 else nodes[node][2]
+        state, output = table[state][nodes[node][1]]
+        outputs.append({label: (output >> i) & 1 for i, label in enumerate(output_labels)})
+    return outputs
+
+
+def run_aiger(circuit, trace):
+    """Returns the outputs of an AIGER circuit on a trace of input valuations."""
+    (i, l, o, a), latches, output_literals, gates, (input_names, _, output_names) = circuit
+    values = [0] * (i + l + a + 1)
+    for k, (_, reset) in enumerate(latches):
+        values[i + k + 1] = reset
+
+    def value(literal):
+        return values[literal >> 1] ^ (literal & 1)
+
+    outputs = []
+    for valuation in trace:
+        for k, name in enumerate(input_names):
+            values[k + 1] = valuation[name]
+        for k, (left, right) in enumerate(gates):
+            values[i + l + k + 1] = value(left) & value(right)
+        outputs.append({name: value(literal) for name, literal in zip(output_names, output_literals)})
+        next_values = [value(next) for next, _ in latches]
+        for k, next_value in enumerate(next_values):
+            values[i + k + 1] = next_value
+    return outputs
+
+
+def main():
+    os.chdir(os.path.join(ROOT, "Benchmarks", "CounterGames"))
+    generator = random.Random(0)
+    failures = 0
+    with tempfile.TemporaryDirectory() as directory:
+        for goal in GOALS:
+            for environment in ENVIRONMENTS:
+                for starting in [0, 1]:
+                    instance = "goal_%d env_%d -s %d" % (goal, environment, starting)
+                    mealy_file = os.path.join(directory, "strategy.h")
+                    aiger_file = os.path.join(directory, "strategy.aag")
+                    try:
+                        subprocess.run([BESYFT, "-a", "goal_%d.ltlf" % goal, "-e", "env_%d.ltlf" % environment,
+                                        "-p", "part_%d.part" % goal, "-s", str(starting), "-t", "3",
+                                        "--mealy", mealy_file, "--aiger", aiger_file],
+                                       stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, check=True)
+                        machine = read_mealy(mealy_file)
+                        circuit = check_aiger.read_ascii(aiger_file)
+                        for _ in range(TRACES):
+                            trace = [{label: generator.randint(0, 1) for label in machine[0]}
+                                     for _ in range(TRACE_LENGTH)]
+                            assert run_mealy(machine, trace) == run_aiger(circuit, trace), \
+                                "the Mealy machine and the circuit disagree"
+                    except (AssertionError, subprocess.CalledProcessError, AttributeError, ValueError,
+                            IndexError, KeyError) as error:
+                        print("FAIL %s: %s" % (instance, error))
+                        failures += 1
+                        continue
+                    print("ok   %s: %d states, %d letters" % (instance, len(machine[3]), len(machine[3][0])))
+    if failures > 0:
+        print("%d Mealy machines failed" % failures)
+        sys.exit(1)
+    print("All Mealy machines agree with their circuits")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,73 @@
+#!/bin/bash
+# Runs a batch of small counter games twice with the same result store, so that
+# the store holds two records of every job, then a third time reusing the
+# results. Checks that every job of the third run is taken from the store and
+# that its results are those of the second run: the records read back equal
+# the ones written, and the newest record of a job shadows the older one.
+#
+# Usage: ./check-result-store.sh [path to BeSyft]
+# Exits with status 1 if some result is not reused or differs.
+
+BESYFT="$(realpath "${1:-build/bin/BeSyft}")"
+GOALS="1 2"
+ENVIRONMENTS="1 2"
+
+cd "$(dirname "$0")/Benchmarks/CounterGames" || exit 1
+
+directory="$(mktemp -d)"
+trap 'rm -rf "$directory"' EXIT
+
+jobs=0
+for goal in $GOALS; do
+    for environment in $ENVIRONMENTS; do
+        for algorithm in 3 4; do
+            for starting in 0 1; do
+                echo "goal_$goal.ltlf env_$environment.ltlf part_$goal.part $algorithm $starting" >> "$directory/batch.manifest"
+                jobs=$((jobs + 1))
+            done
+        done
+    done
+done
+
+for run in 1 2 3; do
+    reuse=""
+    [ "$run" -eq 3 ] && reuse="--reuse-results"
+    if ! "$BESYFT" --batch "$directory/batch.manifest" -f "$directory/results_$run.csv" --result-store "$directory/store" $reuse > "$directory/output_$run.txt" 2>&1; then
+        echo "FAIL run $run: BeSyft failed"
+        cat "$directory/output_$run.txt"
+        exit 1
+    fi
+done
+
+failures=0
+
+records="$(wc -l < "$directory/store")"
+if [ "$records" -ne $((2 * jobs)) ]; then
+    echo "FAIL store: $records records instead of $((2 * jobs))"
+    failures=$((failures + 1))
+fi
+
+cached="$(grep -c "(cached)" "$directory/output_3.txt")"
+if [ "$cached" -ne "$jobs" ]; then
+    echo "FAIL reuse: $cached of $jobs jobs taken from the store"
+    failures=$((failures + 1))
+fi
+
+# The total is summed from the rounded times read back, so it may differ in
+# its last digit
+for job in $(seq 1 "$jobs"); do
+    written="$(sed -n "${job}p" "$directory/results_2.csv" | cut -d, -f1-8,10)"
+    reused="$(sed -n "${job}p" "$directory/results_3.csv" | cut -d, -f1-8,10)"
+    if [ -z "$written" ] || [ "$written" != "$reused" ]; then
+        echo "FAIL job $job: '$reused' instead of '$written'"
+        failures=$((failures + 1))
+    else
+        echo "ok   job $job: $reused"
+    fi
+done
+
+if [ "$failures" -gt 0 ]; then
+    echo "$failures checks failed"
+    exit 1
+fi
+echo "All results are reused from their newest record"
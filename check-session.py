@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+# Builds the goals of small counter games one conjunct at a time with the
+# add_goal requests of the daemon, whose games are bounded by the winning
+# regions of the previous problem, and checks that every verdict is the one of
+# a request stating the conjunction so far from scratch.
+#
+# Usage: ./check-session.py [path to BeSyft]
+# Exits with status 1 if some verdict differs or some request fails.
+
+import json
+import os
+import subprocess
+import sys
+
+BESYFT = os.path.realpath(sys.argv[1] if len(sys.argv) > 1 else "build/bin/BeSyft")
+GOALS = [1, 2, 3]
+ENVIRONMENTS = [1, 2]
+
+
+def conjuncts(formula):
+    """Splits a formula at its top-level conjunctions."""
+    parts, depth, start = [], 0, 0
+    for position, character in enumerate(formula):
+        if character == "(":
+            depth += 1
+        elif character == ")":
+            depth -= 1
+        elif character == "&" and depth == 0:
+            parts.append(formula[start:position].strip())
+            start = position + 1
+    parts.append(formula[start:].strip())
+    return parts
+
+
+def solve(requests):
+    """Sends requests to a daemon reading stdin and returns its responses, skipping its last log line."""
+    lines = "".join(json.dumps(request) + "\n" for request in requests)
+    completed = subprocess.run([BESYFT, "--daemon"], input=lines, stdout=subprocess.PIPE,
+                               stderr=subprocess.DEVNULL, universal_newlines=True, check=True)
+    return [json.loads(line) for line in completed.stdout.splitlines() if line.startswith("{")]
+
+
+def main():
+    os.chdir(os.path.join(os.path.dirname(os.path.realpath(__file__)), "Benchmarks", "CounterGames"))
+    failures = 0
+    for goal in GOALS:
+        with open("goal_%d.ltlf" % goal) as goal_file:
+            goal_conjuncts = conjuncts(goal_file.read().strip())
+        for environment in ENVIRONMENTS:
+            with open("env_%d.ltlf" % environment) as environment_file:
+                assumption = environment_file.read().strip()
+            for starting in ["agent", "environment"]:
+                instance = "goal_%d env_%d %s" % (goal, environment, starting)
+                problem = {"partition": "part_%d.part" % goal, "starting_player": starting}
+                incremental = [dict(problem, goal=goal_conjuncts[0], assumption=assumption)]
+                incremental += [dict(problem, add_goal=conjunct) for conjunct in goal_conjuncts[1:]]
+                from_scratch = [dict(problem, assumption=assumption,
+                                     goal=" & ".join("(%s)" % conjunct for conjunct in goal_conjuncts[:k + 1]))
+                                for k in range(len(goal_conjuncts))]
+                try:
+                    responses = solve(incremental + from_scratch)
+                except (subprocess.CalledProcessError, ValueError) as error:
+                    print("FAIL %s: %s" % (instance, error))
+                    failures += 1
+                    continue
+                if len(responses) != len(incremental + from_scratch):
+                    print("FAIL %s: %d responses to %d requests" % (instance, len(responses), len(incremental + from_scratch)))
+                    failures += 1
+                    continue
+                for k in range(len(goal_conjuncts)):
+                    added = responses[k].get("verdict", responses[k].get("error"))
+                    expected = responses[len(goal_conjuncts) + k].get("verdict", responses[len(goal_conjuncts) + k].get("error"))
+                    if "verdict" not in responses[k] or added != expected:
+                        print("FAIL %s, %d conjuncts: add_goal gives '%s', from scratch '%s'" % (instance, k + 1, added, expected))
+                        failures += 1
+                    else:
+                        print("ok   %s, %d conjuncts: %s" % (instance, k + 1, added))
+    if failures > 0:
+        print("%d verdicts differ" % failures)
+        sys.exit(1)
+    print("All verdicts agree")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,62 @@
+#!/bin/bash
+# Compares the verdicts of the solvers on small counter games: the explicit
+# adversarial solvers (-t 5 to 8) with the symbolic adversarial synthesizer
+# (-t 4), and the monolithic and explicit-compositional best-effort
+# synthesizers (-t 1 and 2) with the symbolic-compositional one (-t 3).
+#
+# Usage: ./check-verdicts.sh [path to BeSyft]
+# Exits with status 1 if some verdict differs or some run fails.
+
+BESYFT="$(realpath "${1:-build/bin/BeSyft}")"
+ADVERSARIAL_ALGORITHMS="5 6 7 8"
+BEST_EFFORT_ALGORITHMS="1 2"
+GOALS="1 2 3"
+ENVIRONMENTS="1 2 3"
+
+cd "$(dirname "$0")/Benchmarks/CounterGames" || exit 1
+RESULTS="$(mktemp)"
+trap 'rm -f "$RESULTS"' EXIT
+
+# Prints the verdict, the last field of the results file
+verdict() {
+    : > "$RESULTS"
+    "$BESYFT" -a "goal_$1.ltlf" -e "env_$2.ltlf" -p "part_$1.part" -s "$3" -t "$4" -f "$RESULTS" > /dev/null 2>&1
+    tail -n 1 "$RESULTS" | awk -F, '{print $NF}'
+}
+
+failures=0
+
+# Compares the algorithms in $2 with the reference algorithm $1 on every instance
+compare() {
+    local reference="$1" algorithms="$2"
+    for goal in $GOALS; do
+        for environment in $ENVIRONMENTS; do
+            for starting in 0 1; do
+                expected="$(verdict "$goal" "$environment" "$starting" "$reference")"
+                if [ -z "$expected" ]; then
+                    echo "FAIL goal_$goal env_$environment -s $starting: -t $reference produced no result"
+                    failures=$((failures + 1))
+                    continue
+                fi
+                for algorithm in $algorithms; do
+                    actual="$(verdict "$goal" "$environment" "$starting" "$algorithm")"
+                    if [ "$actual" != "$expected" ]; then
+                        echo "FAIL goal_$goal env_$environment -s $starting: -t $algorithm gives '$actual', -t $reference gives '$expected'"
+                        failures=$((failures + 1))
+                    else
+                        echo "ok   goal_$goal env_$environment -s $starting -t $algorithm: $actual"
+                    fi
+                done
+            done
+        done
+    done
+}
+
+compare 4 "$ADVERSARIAL_ALGORITHMS"
+compare 3 "$BEST_EFFORT_ALGORITHMS"
+
+if [ "$failures" -gt 0 ]; then
+    echo "$failures verdicts differ"
+    exit 1
+fi
+echo "All verdicts agree"
@@ -1,5 +1,3 @@
 cd Benchmarks/CounterGames
 
-sudo chmod "u+x" exe.sh
-
-./exe.sh
+./../../build/bin/BeSyft --batch batch.manifest --timeout 1000
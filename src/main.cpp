@@ -1,16 +1,41 @@
+#include<sys/resource.h>
 #include<sys/stat.h>
+#include<sys/wait.h>
+#include<poll.h>
+#include<signal.h>
+#include<unistd.h>
+#include<algorithm>
+#include<cerrno>
+#include<chrono>
+#include<csignal>
+#include<cstdio>
 #include<cstring>
 #include<iostream>
 #include<istream>
+#include<limits>
+#include<map>
 #include<memory>
+#include<new>
+#include<sstream>
 #include<CLI/CLI.hpp>
 #include"Stopwatch.h"
 #include"ExplicitStateDfaMona.h"
+#include"BestEffortTransducer.h"
+#include"CancellationToken.h"
+#include"BitSlicedController.h"
+#include"ControllerBenchmark.h"
+#include"MealyMachine.h"
+#include"ResultStore.h"
+#include"SynthesisDaemon.h"
+#include"SynthesisSession.h"
 #include"SymbolicCompositionalBestEffortSynthesizer.h"
 #include"MonolithicBestEffortSynthesizer.h"
 #include"ExplicitCompositionalBestEffortSynthesizer.h"
 #include"AdversarialSynthesizer.h"
+#include"ComponentAdversarialSynthesizer.h"
+#include"ExplicitAdversarialSynthesizer.h"
 #include"spotparser.h"
+#include"BesyftVersion.h"
 using namespace std;
 
 // Function: sumVec
@@ -27,6 +52,939 @@ double sumVec(const std::vector<double>& v)
     return sum;
 }
 
+// Function: benchmark_controller
+/**
+ * @brief Run a transducer on random traces with CUDD, the flattened executor and the bit-sliced controller
+ *
+ * @param[in] transducer - the strategy to run
+ * @param[in] trace_count - the number of traces
+ * @param[in] trace_length - the number of steps of each trace
+ */
+void benchmark_controller(const Syft::Transducer& transducer, std::size_t trace_count, std::size_t trace_length)
+{
+    Syft::ControllerBenchmark benchmark(transducer);
+    Syft::ControllerBenchmarkResult result = benchmark.run(trace_count, trace_length);
+    std::cout << "[BeSyft] Simulated " << trace_count << " traces of " << trace_length << " steps" << std::endl;
+    std::cout << "[BeSyft] BDD::Eval: " << result.eval_time << " s" << std::endl;
+    std::cout << "[BeSyft] Flattened executor: " << result.executor_time << " s" << std::endl;
+    std::cout << "[BeSyft] Bit-sliced controller (" << Syft::BitSlicedController::lane_count << " lanes): " << result.bit_sliced_time << " s" << std::endl;
+    if (!result.outputs_agree) {
+        std::cout << "[BeSyft] Warning: controllers disagree on the outputs" << std::endl;
+    }
+}
+
+// Function: dump_mealy
+/**
+ * @brief Save a transducer as a minimal explicit Mealy machine
+ *
+ * @param[in] transducer - the strategy to save
+ * @param[in] filename - the C header to write
+ */
+void dump_mealy(const Syft::Transducer& transducer, const std::string& filename)
+{
+    Syft::MealyMachine machine = Syft::MealyMachine::from_transducer(transducer);
+    Syft::MealyMachine minimal = machine.minimize();
+    std::cout << "[BeSyft] Mealy machine: " << machine.state_count() << " reachable states, " << minimal.state_count() << " after minimization, " << minimal.letter_count() << " input letter classes" << std::endl;
+    minimal.dump_table(filename);
+}
+
+// Function: report_lazy_strategy
+/**
+ * @brief Time a strategy query for the initial state, before and after it is cached
+ *
+ * @param[in] oracle - the lazy strategy
+ */
+void report_lazy_strategy(const Syft::LazyStrategyOracle& oracle)
+{
+    std::vector<std::uint8_t> input(oracle.input_count(), 0), output;
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        auto start = std::chrono::high_resolution_clock::now();
+        bool found = oracle.query(oracle.initial_state(), input, output);
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start);
+        std::cout << "[BeSyft] Lazy strategy query for the initial state" << (attempt ? " (cached)" : "") << ": " << (found ? "found" : "no winning move") << " in " << elapsed.count() << " us" << std::endl;
+    }
+}
+
+// Function: report_phase
+/**
+ * @brief Print the result of a game of best-effort synthesis as soon as it is solved
+ *
+ * @param[in] phase - the game
+ * @param[in] result - the result of the game
+ * @param[in] running_time - the time spent on the game, in seconds
+ */
+void report_phase(Syft::BestEffortPhase phase, const Syft::SynthesisResult& result, double running_time)
+{
+    std::string game = phase == Syft::BestEffortPhase::Adversarial ? "Adversarial" : "Cooperative";
+    std::cout << "[BeSyft] " << game << " game " << (result.realizability ? "realizable" : "unrealizable") << " after " << running_time << " s" << std::endl;
+}
+
+// Seconds a cancelled run gets to reach a check point before it is ended
+const unsigned int cancellation_grace_period = 10;
+
+// Whether a cancelled process ends itself after the grace period. Cleared in
+// the parent of a parallel batch, which stays responsive and ends its workers
+volatile std::sig_atomic_t exit_after_grace_period = 1;
+
+// Function: cancel_synthesis
+/**
+ * @brief Signal handler that stops synthesis at its next check point, or during the current CUDD operation
+ *
+ * Some steps, such as the LTLf to DFA translation, never reach a check
+ * point. A second signal, or the end of the grace period, ends the process
+ * at once, so that timeout(1) still bounds the running time.
+ *
+ * @param[in] signal_number - the received signal, SIGALRM at the end of the grace period
+ */
+void cancel_synthesis(int signal_number)
+{
+    if (signal_number == SIGALRM || Syft::CancellationToken::global().cancel_requested()) _exit(128 + signal_number);
+    Syft::CancellationToken::global().cancel();
+    if (exit_after_grace_period) alarm(cancellation_grace_period);
+}
+
+// Struct: StrategyOutputs
+/**
+ * @brief What a single run does with the strategy it computes
+ */
+struct StrategyOutputs
+{
+    bool print_dot = false;
+    std::size_t simulate_traces = 0;
+    std::size_t trace_length = 1000;
+    std::string aiger_file;
+    std::string mealy_file;
+    Syft::DontCareMinimization minimization = Syft::DontCareMinimization::None;
+};
+
+// Function: use_best_effort_strategy
+/**
+ * @brief Print, simulate or save the best-effort strategy of a single run
+ *
+ * The adversarial and cooperative strategies are merged into a single
+ * BestEffortTransducer, built only if some output needs it. Minimization
+ * applies to the merged controller: following cooperative moves, it reaches
+ * adversarially winning states that the adversarial strategy alone never
+ * reaches, and those must keep their adversarial outputs.
+ *
+ * @param[in] result - the adversarial and cooperative results of the synthesizer
+ * @param[in] outputs - what to do with the strategy
+ */
+void use_best_effort_strategy(const std::pair<Syft::SynthesisResult, Syft::SynthesisResult>& result, const StrategyOutputs& outputs)
+{
+    if (!result.first.realizability && !result.second.realizability) return;
+    const Syft::SynthesisResult& winning = result.first.realizability ? result.first : result.second;
+    if (winning.strategy_oracle) report_lazy_strategy(*winning.strategy_oracle);
+    if (!result.first.transducer || !result.second.transducer) return;
+    bool dump_best_effort = outputs.print_dot && !result.first.realizability;
+    if (outputs.print_dot) {
+        std::cout << "[BeSyft] Printing output function" << (dump_best_effort ? "s" : "") << std::endl;
+        result.first.transducer -> dump_dot("adv_outfunct.dot");
+        if (dump_best_effort) result.second.transducer -> dump_dot("coop_outfunct");
+    }
+    if (!dump_best_effort && outputs.simulate_traces == 0 && outputs.aiger_file == "" && outputs.mealy_file == "" && outputs.minimization == Syft::DontCareMinimization::None) return;
+    Syft::BestEffortTransducer best_effort_transducer(result.first, result.second);
+    best_effort_transducer.minimize(outputs.minimization);
+    if (dump_best_effort) best_effort_transducer.dump_dot("be_outfunct.dot");
+    if (outputs.simulate_traces > 0) benchmark_controller(best_effort_transducer, outputs.simulate_traces, outputs.trace_length);
+    if (outputs.aiger_file != "") best_effort_transducer.dump_aiger(outputs.aiger_file);
+    if (outputs.mealy_file != "") dump_mealy(best_effort_transducer, outputs.mealy_file);
+}
+
+// Function: use_adversarial_strategy
+/**
+ * @brief Print, simulate or save the winning strategy of a single adversarial run
+ *
+ * @param[in] result - the result of the synthesizer
+ * @param[in] algorithm - the name of the algorithm, for solvers that compute no output functions
+ * @param[in] outputs - what to do with the strategy
+ */
+void use_adversarial_strategy(Syft::SynthesisResult& result, const std::string& algorithm, const StrategyOutputs& outputs)
+{
+    if (!result.realizability) return;
+    if (result.strategy_oracle) report_lazy_strategy(*result.strategy_oracle);
+    if (!result.transducer) {
+        if (outputs.print_dot || outputs.simulate_traces > 0 || outputs.aiger_file != "" || outputs.mealy_file != "") {
+            std::cout << "[BeSyft] The " << algorithm << " does not compute output functions" << std::endl;
+        }
+        return;
+    }
+    result.transducer -> minimize(result.winning_states, outputs.minimization);
+    if (outputs.print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.transducer -> dump_dot("adv_outfunct.dot");}
+    if (outputs.simulate_traces > 0) benchmark_controller(*result.transducer, outputs.simulate_traces, outputs.trace_length);
+    if (outputs.aiger_file != "") result.transducer -> dump_aiger(outputs.aiger_file);
+    if (outputs.mealy_file != "") dump_mealy(*result.transducer, outputs.mealy_file);
+}
+
+// Type: SynthesisOutcome
+/**
+ * @brief Result of a synthesizer, as stored in the results file and in the result store
+ */
+using SynthesisOutcome = Syft::StoredResult;
+
+// Function: best_effort_verdict
+/**
+ * @brief Realizability verdict of a best-effort synthesizer
+ *
+ * @param[in] result - the adversarial and cooperative results of the synthesizer
+ * @return Adv, Coop or Unr
+ */
+std::string best_effort_verdict(const std::pair<Syft::SynthesisResult, Syft::SynthesisResult>& result)
+{
+    if (result.first.realizability) return "Adv";
+    if (result.second.realizability) return "Coop";
+    return "Unr";
+}
+
+// Function: solve_best_effort
+/**
+ * @brief Run a best-effort synthesizer and summarize its result
+ *
+ * @param[in] synthesizer - the synthesizer to run
+ * @param[in] algorithm - the name of the algorithm, as stored in the results file
+ * @param[in] outputs - what to do with the strategy, or nullptr to discard it
+ * @return The running times and the realizability verdict (Adv, Coop or Unr)
+ */
+template <class BestEffortSynthesizer>
+SynthesisOutcome solve_best_effort(BestEffortSynthesizer& synthesizer, const std::string& algorithm, const StrategyOutputs* outputs = nullptr)
+{
+    auto result = synthesizer.run();
+    if (outputs) use_best_effort_strategy(result, *outputs);
+    SynthesisOutcome outcome;
+    outcome.algorithm = algorithm;
+    outcome.run_times = synthesizer.get_running_times();
+    outcome.verdict = best_effort_verdict(result);
+    return outcome;
+}
+
+// Function: solve_adversarial
+/**
+ * @brief Run an adversarial synthesizer and summarize its result
+ *
+ * @param[in] synthesizer - the synthesizer to run
+ * @param[in] algorithm - the name of the algorithm, as stored in the results file
+ * @param[in] outputs - what to do with the strategy, or nullptr to discard it
+ * @return The running times and the realizability verdict (Adv or Unr)
+ */
+template <class AdversarialSynthesizer>
+SynthesisOutcome solve_adversarial(AdversarialSynthesizer& synthesizer, const std::string& algorithm, const StrategyOutputs* outputs = nullptr)
+{
+    auto result = synthesizer.run();
+    if (outputs) use_adversarial_strategy(result, algorithm, *outputs);
+    SynthesisOutcome outcome;
+    outcome.algorithm = algorithm;
+    outcome.run_times = synthesizer.get_running_times();
+    outcome.verdict = result.realizability ? "Adv" : "Unr";
+    return outcome;
+}
+
+// Function: algorithm_name
+/**
+ * @brief Name of an algorithm, as stored in the results file
+ *
+ * @param[in] alg_id - the algorithm, as passed to -t
+ * @return The name of the algorithm
+ */
+std::string algorithm_name(int alg_id)
+{
+    const std::vector<std::string> algorithm_names = {"Monolithic Best-Effort Synthesizer", "Explicit-Compositional Best-Effort Synthesizer", "Symbolic-Compositional Best-Effort Synthesizer", "Adversarial Synthesizer", "Hybrid Adversarial Synthesizer", "Bit-Parallel Adversarial Synthesizer", "On-the-fly Adversarial Synthesizer", "Antichain Adversarial Synthesizer", "Portfolio"};
+    if (alg_id < 1 || alg_id > static_cast<int>(algorithm_names.size())) throw std::runtime_error("Error: Non-existing algorithm " + std::to_string(alg_id));
+    return algorithm_names[alg_id - 1];
+}
+
+// Function: write_outcome
+/**
+ * @brief Append the result of a synthesizer to the results file
+ *
+ * Phases that were not run, such as the cooperative game of adversarial
+ * synthesis or the phases after a timeout, are stored as NA.
+ *
+ * @param[in] outstream - the results file
+ * @param[in] outcome - the result to store
+ * @param[in] agent_file - the file of the agent goal
+ * @param[in] environment_file - the file of the environment assumption
+ * @param[in] starting_flag - 1 if the agent moves first, 0 otherwise
+ */
+void write_outcome(std::ostream& outstream, const SynthesisOutcome& outcome, const std::string& agent_file, const std::string& environment_file, int starting_flag)
+{
+    outstream << outcome.algorithm << "," << agent_file << "," << environment_file << ",";
+    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
+    for (std::size_t i = 0; i < 4; ++i) {
+        if (i < outcome.run_times.size()) outstream << outcome.run_times[i] << ","; else outstream << "NA,";
+    }
+    outstream << sumVec(outcome.run_times) << "," << outcome.verdict << std::endl;
+}
+
+// Function: read_formula
+/**
+ * @brief Read an LTLf formula from the first line of a file
+ *
+ * @param[in] filename - the file to read
+ * @return The formula
+ */
+std::string read_formula(const std::string& filename)
+{
+    std::ifstream stream(filename);
+    if (!stream) throw std::runtime_error("Error: cannot open " + filename);
+    std::string formula;
+    std::getline(stream, formula);
+    return formula;
+}
+
+// Function: send_outcome
+/**
+ * @brief Write the result of a synthesizer to a pipe, for the parent process to read
+ *
+ * @param[in] fd - the write end of the pipe
+ * @param[in] outcome - the result to send
+ * @return Whether the whole result was written
+ */
+bool send_outcome(int fd, const SynthesisOutcome& outcome)
+{
+    std::ostringstream message;
+    message << outcome.algorithm << "\n" << outcome.verdict << "\n";
+    for (double time : outcome.run_times) message << time << " ";
+    std::string text = message.str();
+    std::size_t written = 0;
+    while (written < text.size()) {
+        ssize_t n = write(fd, text.data() + written, text.size() - written);
+        if (n <= 0) return false;
+        written += n;
+    }
+    return true;
+}
+
+// Function: parse_outcome
+/**
+ * @brief Read a result written by send_outcome
+ *
+ * @param[in] text - everything read from the pipe
+ * @param[out] outcome - the result
+ * @return Whether a result was sent, as a worker that crashes closes its pipe without writing
+ */
+bool parse_outcome(const std::string& text, SynthesisOutcome& outcome)
+{
+    if (text.empty()) return false;
+    std::istringstream message(text);
+    std::getline(message, outcome.algorithm);
+    std::getline(message, outcome.verdict);
+    outcome.run_times.clear();
+    double time;
+    while (message >> time) outcome.run_times.push_back(time);
+    return true;
+}
+
+// Function: run_portfolio
+/**
+ * @brief Run the three best-effort synthesizers concurrently and keep the first to finish
+ *
+ * Each synthesizer runs in its own process, since CUDD and MONA are not
+ * thread-safe. The first worker to report a result wins, the others are killed.
+ *
+ * @param[in] agent_specification - the LTLf goal of the agent
+ * @param[in] environment_assumption - the LTLf assumption on the environment
+ * @param[in] partition - the partition of the variables
+ * @param[in] starting_player - the player moving first
+ * @param[in] extraction_options - the options of the strategy extraction
+ * @param[out] winner - the result of the first worker to finish
+ * @return Whether some worker completed. Throws a SynthesisTimeout instead if synthesis was cancelled
+ */
+bool run_portfolio(const std::string& agent_specification, const std::string& environment_assumption, const Syft::InputOutputPartition& partition, Syft::Player starting_player, const Syft::StrategyExtractionOptions& extraction_options, SynthesisOutcome& winner)
+{
+    const std::vector<int> portfolio = {1, 2, 3};
+    std::vector<pid_t> workers;
+    std::vector<int> channels;
+    std::cout.flush();
+
+    for (int id : portfolio) {
+        int fds[2];
+        if (pipe(fds) != 0) throw std::runtime_error("Error: cannot create a pipe for the portfolio");
+        pid_t pid = fork();
+        if (pid < 0) throw std::runtime_error("Error: cannot start a portfolio worker");
+        if (pid == 0) {
+            close(fds[0]);
+            for (int channel : channels) close(channel);
+            // Only the winner is reported, by the parent
+            if (!std::freopen("/dev/null", "w", stdout)) _exit(1);
+            try {
+                std::shared_ptr<Syft::VarMgr> v_mgr = std::make_shared<Syft::VarMgr>();
+                SynthesisOutcome outcome;
+                if (id == 1) {
+                    Syft::MonolithicBestEffortSynthesizer synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player, extraction_options);
+                    outcome = solve_best_effort(synthesizer, "Monolithic Best-Effort Synthesizer");
+                } else if (id == 2) {
+                    Syft::ExplicitCompositionalBestEffortSynthesizer synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player, extraction_options);
+                    outcome = solve_best_effort(synthesizer, "Explicit-Compositional Best-Effort Synthesizer");
+                } else {
+                    Syft::SymbolicCompositionalBestEffortSynthesizer synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player, extraction_options);
+                    outcome = solve_best_effort(synthesizer, "Symbolic-Compositional Best-Effort Synthesizer");
+                }
+                if (!send_outcome(fds[1], outcome)) _exit(1);
+            } catch (const std::exception&) {
+                _exit(1);
+            }
+            close(fds[1]);
+            _exit(0);
+        }
+        close(fds[1]);
+        workers.push_back(pid);
+        channels.push_back(fds[0]);
+    }
+
+    // The first result sent is the first completed result
+    bool found = false;
+    std::vector<bool> open(channels.size(), true);
+    std::size_t remaining = channels.size();
+    while (!found && remaining > 0) {
+        std::vector<pollfd> polled;
+        std::vector<std::size_t> positions;
+        for (std::size_t i = 0; i < channels.size(); ++i) {
+            if (open[i]) {polled.push_back({channels[i], POLLIN, 0}); positions.push_back(i);}
+        }
+        if (poll(polled.data(), polled.size(), -1) < 0) {
+            if (errno == EINTR && !Syft::CancellationToken::global().cancelled()) continue;
+            break;
+        }
+        for (std::size_t j = 0; j < polled.size() && !found; ++j) {
+            if (polled[j].revents == 0) continue;
+            std::size_t i = positions[j];
+            std::string text;
+            char buffer[4096];
+            ssize_t n;
+            while ((n = read(channels[i], buffer, sizeof(buffer))) > 0) text.append(buffer, n);
+            close(channels[i]);
+            open[i] = false;
+            --remaining;
+            found = parse_outcome(text, winner);
+        }
+    }
+
+    for (std::size_t i = 0; i < workers.size(); ++i) {
+        if (open[i]) close(channels[i]);
+        kill(workers[i], SIGKILL);
+        waitpid(workers[i], nullptr, 0);
+    }
+    // Workers stop silently on timeout, as they share the deadline
+    if (!found) Syft::CancellationToken::global().check();
+    return found;
+}
+
+// Function: run_algorithm
+/**
+ * @brief Run one of the algorithms on a fresh variable manager and summarize its result
+ *
+ * @param[in] alg_id - the algorithm, as passed to -t
+ * @param[in] agent_specification - the LTLf goal of the agent
+ * @param[in] environment_assumption - the LTLf assumption on the environment
+ * @param[in] partition - the partition of the variables
+ * @param[in] starting_player - the player moving first
+ * @param[in] extraction_options - the options of the strategy extraction
+ * @param[in] anytime_options - the reporting and skipping options of the best-effort algorithms
+ * @param[in] outputs - what to do with the strategy, or nullptr to discard it
+ * @return The running times and the realizability verdict
+ */
+SynthesisOutcome run_algorithm(int alg_id, const std::string& agent_specification, const std::string& environment_assumption, const Syft::InputOutputPartition& partition, Syft::Player starting_player, const Syft::StrategyExtractionOptions& extraction_options, const Syft::AnytimeOptions& anytime_options = Syft::AnytimeOptions(), const StrategyOutputs* outputs = nullptr)
+{
+    std::shared_ptr<Syft::VarMgr> v_mgr = std::make_shared<Syft::VarMgr>();
+    std::string name = algorithm_name(alg_id);
+    if (alg_id == 1) {
+        Syft::MonolithicBestEffortSynthesizer synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player, extraction_options);
+        synthesizer.set_anytime_options(anytime_options);
+        return solve_best_effort(synthesizer, name, outputs);
+    } else if (alg_id == 2) {
+        Syft::ExplicitCompositionalBestEffortSynthesizer synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player, extraction_options);
+        synthesizer.set_anytime_options(anytime_options);
+        return solve_best_effort(synthesizer, name, outputs);
+    } else if (alg_id == 3) {
+        Syft::SymbolicCompositionalBestEffortSynthesizer synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player, extraction_options);
+        synthesizer.set_anytime_options(anytime_options);
+        return solve_best_effort(synthesizer, name, outputs);
+    } else if (alg_id == 4) {
+        Syft::AdversarialSynthesizer synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player, extraction_options);
+        return solve_adversarial(synthesizer, name, outputs);
+    } else if (alg_id == 5 || alg_id == 6) {
+        Syft::ExplicitAdversarialSynthesizer synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player, alg_id == 5 ? Syft::ExplicitGameSolver::Hybrid : Syft::ExplicitGameSolver::BitParallel);
+        return solve_adversarial(synthesizer, name, outputs);
+    } else if (alg_id == 7 || alg_id == 8) {
+        Syft::ComponentAdversarialSynthesizer synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player, alg_id == 7 ? Syft::ComponentGameSolver::OnTheFly : Syft::ComponentGameSolver::Antichain);
+        return solve_adversarial(synthesizer, name, outputs);
+    } else {
+        SynthesisOutcome outcome;
+        if (!run_portfolio(agent_specification, environment_assumption, partition, starting_player, extraction_options, outcome)) {
+            throw std::runtime_error("Error: No portfolio worker completed");
+        }
+        if (outputs && outputs->print_dot) std::cout << "[BeSyft] Portfolio workers do not return output functions" << std::endl;
+        outcome.algorithm = "Portfolio[" + outcome.algorithm + "]";
+        return outcome;
+    }
+}
+
+// Function: describe_verdict
+/**
+ * @brief Sentence reporting the verdict of a run
+ *
+ * @param[in] outcome - the result of the run
+ * @param[in] alg_id - the algorithm, as passed to -t
+ * @return The sentence
+ */
+std::string describe_verdict(const SynthesisOutcome& outcome, int alg_id)
+{
+    if (outcome.verdict == "Adv") return "Adversarially realizable.";
+    if (outcome.verdict == "Coop") return "Cooperatively realizable.";
+    if (alg_id >= 4 && alg_id <= 8) return "Not adversarially realizable.";
+    return "Unrealizable.";
+}
+
+// Function: run_dual
+/**
+ * @brief Run symbolic-compositional best-effort synthesis with each starting player on a single arena
+ *
+ * The DFAs, the arena and the compose vector of its transition function are
+ * built once. The outcome of the agent moving first gets the LTLf2DFA and
+ * DFA2Sym times and the other one gets 0 for them, so that the totals of both
+ * add up to the time of the run. A solve has one game time when the
+ * cooperative game is skipped. On a timeout, the solves that did not complete
+ * get a TIMEOUT verdict.
+ *
+ * @param[in] agent_specification - the agent goal
+ * @param[in] environment_assumption - the environment assumption
+ * @param[in] partition - the partition of the variables
+ * @param[in] extraction_options - the options of the strategy extraction
+ * @param[in] anytime_options - the reporting and skipping options, applying to both solves
+ * @return The outcomes with the agent and with the environment moving first, in this order
+ */
+std::pair<SynthesisOutcome, SynthesisOutcome> run_dual(const std::string& agent_specification, const std::string& environment_assumption, const Syft::InputOutputPartition& partition, const Syft::StrategyExtractionOptions& extraction_options, const Syft::AnytimeOptions& anytime_options)
+{
+    std::string algorithm = algorithm_name(3);
+    std::pair<SynthesisOutcome, SynthesisOutcome> outcomes = {{algorithm, {}, "TIMEOUT"}, {algorithm, {}, "TIMEOUT"}};
+    std::vector<double> run_times;
+    // Number of phases up to the end of the solve with the agent moving first, once it completes
+    std::size_t agent_phase_count = 0;
+    try {
+        Syft::SymbolicCompositionalBestEffortSynthesizer synthesizer(std::make_shared<Syft::VarMgr>(), agent_specification, environment_assumption, partition, Syft::Player::Agent, extraction_options);
+        synthesizer.set_anytime_options(anytime_options);
+        std::cout << "[BeSyft] Solving the games with the agent moving first" << std::endl;
+        outcomes.first.verdict = best_effort_verdict(synthesizer.run(Syft::Player::Agent));
+        agent_phase_count = synthesizer.get_running_times().size();
+        std::cout << "[BeSyft] Solving the games with the environment moving first" << std::endl;
+        outcomes.second.verdict = best_effort_verdict(synthesizer.run(Syft::Player::Environment));
+        run_times = synthesizer.get_running_times();
+    } catch (const Syft::SynthesisTimeout& timeout) {
+        run_times = timeout.running_times();
+    }
+    if (agent_phase_count == 0) agent_phase_count = run_times.size();
+    outcomes.first.run_times.assign(run_times.begin(), run_times.begin() + agent_phase_count);
+    if (run_times.size() > agent_phase_count) {
+        outcomes.second.run_times = {0, 0};
+        outcomes.second.run_times.insert(outcomes.second.run_times.end(), run_times.begin() + agent_phase_count, run_times.end());
+    }
+    return outcomes;
+}
+
+// Struct: BatchJob
+/**
+ * @brief A line of a batch manifest
+ */
+struct BatchJob
+{
+    std::string agent_file;
+    std::string environment_file;
+    std::string partition_file;
+    int alg_id;
+    int starting_flag;
+    std::string results_file;
+};
+
+// Function: read_manifest
+/**
+ * @brief Read the jobs of a batch manifest
+ *
+ * Each line holds a goal file, an environment file, a partition file, an
+ * algorithm and a starting player, as passed to -a, -e, -p, -t and -s, and
+ * optionally a results file that overrides -f. Empty lines and lines starting
+ * with # are skipped.
+ *
+ * @param[in] filename - the manifest
+ * @param[in] default_results_file - the results file of jobs that do not name one
+ * @return The jobs, in file order
+ */
+std::vector<BatchJob> read_manifest(const std::string& filename, const std::string& default_results_file)
+{
+    std::ifstream manifest(filename);
+    if (!manifest) throw std::runtime_error("Error: cannot open " + filename);
+    std::vector<BatchJob> jobs;
+    std::string line;
+    std::size_t line_number = 0;
+    while (std::getline(manifest, line)) {
+        ++line_number;
+        std::istringstream fields(line);
+        BatchJob job;
+        if (!(fields >> job.agent_file) || job.agent_file[0] == '#') continue;
+        if (!(fields >> job.environment_file >> job.partition_file >> job.alg_id >> job.starting_flag)) {
+            throw std::runtime_error("Error: Wrong format in line " + std::to_string(line_number) + " of " + filename);
+        }
+        if (!(fields >> job.results_file)) job.results_file = default_results_file;
+        algorithm_name(job.alg_id);
+        jobs.push_back(job);
+    }
+    return jobs;
+}
+
+// Function: job_key
+/**
+ * @brief Key of a job in the result store
+ *
+ * @param[in] job - the job
+ * @return The canonical key of the problem solved by the job with this binary
+ */
+std::string job_key(const BatchJob& job)
+{
+    Syft::Player starting_player = job.starting_flag == 1 ? Syft::Player::Agent : Syft::Player::Environment;
+    return Syft::ResultStore::make_key(read_formula(job.agent_file), read_formula(job.environment_file), Syft::InputOutputPartition::read_from_file(job.partition_file), starting_player, job.alg_id, BESYFT_VERSION);
+}
+
+// Function: is_conclusive
+/**
+ * @brief Whether a result does not depend on the limits of the run, and may be reused
+ *
+ * @param[in] outcome - the result
+ */
+bool is_conclusive(const SynthesisOutcome& outcome)
+{
+    return outcome.verdict != "TIMEOUT" && outcome.verdict != "MEMOUT" && outcome.verdict != "CRASH";
+}
+
+// Function: killed_worker_verdict
+/**
+ * @brief The verdict of a batch worker that died before sending its result
+ *
+ * Failed allocations do not always reach a std::bad_alloc handler: MONA and
+ * CUDD may abort or dereference a null pointer, and the kernel may kill the
+ * process. Under a memory limit, a worker killed by a signal is taken to have
+ * run out of memory.
+ *
+ * @param[in] wait_status - the status reported by waitpid
+ * @param[in] memory_limit - the address space limit of the worker, in MB (0 = no limit)
+ * @param[out] verdict - MEMOUT or CRASH
+ * @return Whether the worker was killed by a signal. Workers that exit report their own errors
+ */
+bool killed_worker_verdict(int wait_status, std::size_t memory_limit, std::string& verdict)
+{
+    if (!WIFSIGNALED(wait_status)) return false;
+    int signal_number = WTERMSIG(wait_status);
+    bool allocation_failure = signal_number == SIGKILL || signal_number == SIGSEGV || signal_number == SIGBUS || signal_number == SIGABRT;
+    verdict = memory_limit > 0 && allocation_failure ? "MEMOUT" : "CRASH";
+    return true;
+}
+
+// Function: execute_job
+/**
+ * @brief Run a job of a batch manifest and summarize its result
+ *
+ * Jobs that time out or run out of memory still have a result, with the
+ * running times of their completed phases and a TIMEOUT or MEMOUT verdict.
+ *
+ * @param[in] job - the job to run
+ * @param[in] sessions - the sessions of symbolic-compositional jobs, by partition file and starting player, or nullptr not to share DFAs
+ * @param[in] extraction_options - the options of the strategy extraction
+ * @param[out] outcome - the result of the job
+ * @param[out] error - the reason why the job failed
+ * @return Whether the job has a result
+ */
+bool execute_job(const BatchJob& job, std::map<std::pair<std::string, int>, std::unique_ptr<Syft::SynthesisSession>>* sessions, const Syft::StrategyExtractionOptions& extraction_options, SynthesisOutcome& outcome, std::string& error)
+{
+    try {
+        std::string agent_specification = read_formula(job.agent_file);
+        std::string environment_assumption = read_formula(job.environment_file);
+        Syft::InputOutputPartition partition = Syft::InputOutputPartition::read_from_file(job.partition_file);
+        Syft::Player starting_player = job.starting_flag == 1 ? Syft::Player::Agent : Syft::Player::Environment;
+        if (sessions && job.alg_id == 3) {
+            std::unique_ptr<Syft::SynthesisSession>& session = (*sessions)[std::make_pair(job.partition_file, job.starting_flag)];
+            if (!session) session.reset(new Syft::SynthesisSession(partition, starting_player, extraction_options));
+            auto result = session->run(agent_specification, environment_assumption);
+            outcome.algorithm = algorithm_name(job.alg_id);
+            outcome.run_times = session->get_running_times();
+            outcome.verdict = best_effort_verdict(result);
+        } else {
+            outcome = run_algorithm(job.alg_id, agent_specification, environment_assumption, partition, starting_player, extraction_options);
+        }
+    } catch (const Syft::SynthesisTimeout& timeout) {
+        outcome.algorithm = algorithm_name(job.alg_id);
+        outcome.run_times = timeout.running_times();
+        outcome.verdict = "TIMEOUT";
+    } catch (const std::bad_alloc&) {
+        outcome = {algorithm_name(job.alg_id), {}, "MEMOUT"};
+    } catch (const std::exception& exception) {
+        // CUDD reports failed allocations through its error handler
+        if (std::string(exception.what()) == "Out of memory.") {
+            outcome = {algorithm_name(job.alg_id), {}, "MEMOUT"};
+            return true;
+        }
+        error = exception.what();
+        return false;
+    }
+    return true;
+}
+
+// Function: save_outcome
+/**
+ * @brief Append the result of a job to its results file
+ *
+ * @param[in] outstreams - the open results files, by name
+ * @param[in] job - the job
+ * @param[in] outcome - the result of the job
+ */
+void save_outcome(std::map<std::string, std::unique_ptr<std::ofstream>>& outstreams, const BatchJob& job, const SynthesisOutcome& outcome)
+{
+    if (job.results_file == "") return;
+    std::unique_ptr<std::ofstream>& outstream = outstreams[job.results_file];
+    if (!outstream) outstream.reset(new std::ofstream(job.results_file, std::ifstream::app));
+    write_outcome(*outstream, outcome, job.agent_file, job.environment_file, job.starting_flag);
+}
+
+// Function: run_batch
+/**
+ * @brief Run the jobs of a batch manifest in this process
+ *
+ * Every job gets a fresh variable manager, except symbolic-compositional jobs
+ * when DFAs are shared: those run in one SynthesisSession per partition and
+ * starting player, which translates each formula once. Results files stay open
+ * for the whole batch.
+ *
+ * @param[in] manifest - the manifest
+ * @param[in] outfile - the results file of jobs that do not name one
+ * @param[in] share_dfas - whether symbolic-compositional jobs share DFAs
+ * @param[in] timeout - the time limit of each job, in seconds (0 = no limit)
+ * @param[in] extraction_options - the options of the strategy extraction
+ * @param[in] store - the store recording the results, or nullptr
+ * @param[in] reuse - whether jobs with a result in the store are skipped
+ * @return The number of failed jobs
+ */
+std::size_t run_batch(const std::string& manifest, const std::string& outfile, bool share_dfas, double timeout, const Syft::StrategyExtractionOptions& extraction_options, Syft::ResultStore* store, bool reuse)
+{
+    std::vector<BatchJob> jobs = read_manifest(manifest, outfile);
+    std::map<std::string, std::unique_ptr<std::ofstream>> outstreams;
+    std::map<std::pair<std::string, int>, std::unique_ptr<Syft::SynthesisSession>> sessions;
+    std::size_t failed = 0;
+
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+        const BatchJob& job = jobs[i];
+        if (Syft::CancellationToken::global().cancel_requested()) {
+            std::cout << "[BeSyft] Batch interrupted after " << i << " of " << jobs.size() << " jobs" << std::endl;
+            break;
+        }
+        std::cout << "[BeSyft] Job " << i + 1 << " of " << jobs.size() << ": -a " << job.agent_file << " -e " << job.environment_file << " -p " << job.partition_file << " -t " << job.alg_id << " -s " << job.starting_flag << std::endl;
+
+        // Jobs whose files cannot be read have no key, and fail below
+        std::string key;
+        if (store) {
+            try {key = job_key(job);} catch (const std::exception&) {}
+        }
+        SynthesisOutcome outcome;
+        if (reuse && key != "" && store->lookup(key, outcome)) {
+            std::cout << "[BeSyft] Job " << i + 1 << ": " << outcome.verdict << " in " << sumVec(outcome.run_times) << " s (cached)" << std::endl;
+            save_outcome(outstreams, job, outcome);
+            continue;
+        }
+
+        if (timeout > 0) Syft::CancellationToken::global().set_deadline(timeout);
+        std::string error;
+        if (!execute_job(job, share_dfas ? &sessions : nullptr, extraction_options, outcome, error)) {
+            std::cerr << "[BeSyft] Job " << i + 1 << " failed: " << error << std::endl;
+            ++failed;
+            continue;
+        }
+
+        std::cout << "[BeSyft] Job " << i + 1 << ": " << outcome.verdict << " in " << sumVec(outcome.run_times) << " s" << std::endl;
+        save_outcome(outstreams, job, outcome);
+        if (key != "" && is_conclusive(outcome)) store->insert(key, outcome);
+    }
+    return failed;
+}
+
+// Function: estimated_job_size
+/**
+ * @brief Estimate the cost of a job from the length of its formulas
+ *
+ * @param[in] job - the job
+ * @return The total length of the goal and the assumption, or 0 if they cannot be read
+ */
+std::size_t estimated_job_size(const BatchJob& job)
+{
+    try {
+        return read_formula(job.agent_file).size() + read_formula(job.environment_file).size();
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+// Function: run_parallel_batch
+/**
+ * @brief Run the jobs of a batch manifest on a pool of worker processes
+ *
+ * Each job runs in a process of its own, so that a crash or a memory limit
+ * only affects that job. A job whose worker is killed by a signal gets a
+ * MEMOUT or CRASH verdict, see killed_worker_verdict. Workers stop at the
+ * deadline of their job only at check points, so a worker still running
+ * cancellation_grace_period seconds after it is killed and gets a TIMEOUT
+ * verdict. Interrupting the batch forwards SIGTERM to the workers. Jobs are handed out largest first to whichever worker
+ * slot frees up, so long jobs start early and short ones fill the gaps.
+ * Results are written in manifest order, whatever the completion order.
+ *
+ * @param[in] manifest - the manifest
+ * @param[in] outfile - the results file of jobs that do not name one
+ * @param[in] worker_count - the number of jobs run at the same time
+ * @param[in] memory_limit - the address space limit of each job, in MB (0 = no limit)
+ * @param[in] timeout - the time limit of each job, in seconds (0 = no limit)
+ * @param[in] extraction_options - the options of the strategy extraction
+ * @param[in] store - the store recording the results, or nullptr. Only this process writes to it
+ * @param[in] reuse - whether jobs with a result in the store are skipped
+ * @return The number of failed jobs, including crashed ones
+ */
+std::size_t run_parallel_batch(const std::string& manifest, const std::string& outfile, std::size_t worker_count, std::size_t memory_limit, double timeout, const Syft::StrategyExtractionOptions& extraction_options, Syft::ResultStore* store, bool reuse)
+{
+    std::vector<BatchJob> jobs = read_manifest(manifest, outfile);
+    std::vector<std::size_t> sizes;
+    std::vector<std::string> keys(jobs.size());
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+        sizes.push_back(estimated_job_size(jobs[i]));
+        if (store) {
+            try {keys[i] = job_key(jobs[i]);} catch (const std::exception&) {}
+        }
+    }
+    std::vector<std::size_t> order(jobs.size());
+    for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t lhs, std::size_t rhs) {return sizes[lhs] > sizes[rhs];});
+
+    struct Worker {pid_t pid; int channel; std::size_t job; std::string text; std::chrono::steady_clock::time_point deadline; bool killed;};
+    enum class JobStatus {Pending, Done, Failed};
+    std::vector<JobStatus> status(jobs.size(), JobStatus::Pending);
+    std::vector<SynthesisOutcome> outcomes(jobs.size());
+    std::vector<Worker> workers;
+    std::map<std::string, std::unique_ptr<std::ofstream>> outstreams;
+    std::size_t next = 0, next_to_save = 0, failed = 0;
+    bool interrupted = false;
+    std::cout.flush();
+    exit_after_grace_period = 0;
+
+    while (true) {
+        while (workers.size() < worker_count && next < order.size() && !Syft::CancellationToken::global().cancel_requested()) {
+            std::size_t i = order[next++];
+            if (reuse && keys[i] != "" && store->lookup(keys[i], outcomes[i])) {
+                status[i] = JobStatus::Done;
+                std::cout << "[BeSyft] Job " << i + 1 << " of " << jobs.size() << " (" << jobs[i].agent_file << ", " << jobs[i].environment_file << ", -t " << jobs[i].alg_id << "): " << outcomes[i].verdict << " in " << sumVec(outcomes[i].run_times) << " s (cached)" << std::endl;
+                continue;
+            }
+            int fds[2];
+            if (pipe(fds) != 0) throw std::runtime_error("Error: cannot create a pipe for a batch worker");
+            pid_t pid = fork();
+            if (pid < 0) throw std::runtime_error("Error: cannot start a batch worker");
+            if (pid == 0) {
+                exit_after_grace_period = 1;
+                close(fds[0]);
+                for (const Worker& worker : workers) close(worker.channel);
+                // Synthesizer logs of concurrent jobs would interleave
+                if (!std::freopen("/dev/null", "w", stdout)) _exit(1);
+                if (memory_limit > 0) {
+                    rlimit limit;
+                    limit.rlim_cur = limit.rlim_max = static_cast<rlim_t>(memory_limit) * 1024 * 1024;
+                    setrlimit(RLIMIT_AS, &limit);
+                }
+                if (timeout > 0) Syft::CancellationToken::global().set_deadline(timeout);
+                SynthesisOutcome outcome;
+                std::string error;
+                if (!execute_job(jobs[i], nullptr, extraction_options, outcome, error)) {
+                    std::cerr << "[BeSyft] Job " << i + 1 << " failed: " << error << std::endl;
+                    _exit(1);
+                }
+                _exit(send_outcome(fds[1], outcome) ? 0 : 1);
+            }
+            close(fds[1]);
+            std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(timeout + cancellation_grace_period));
+            workers.push_back({pid, fds[0], i, "", deadline, false});
+        }
+        if (workers.empty()) break;
+
+        if (Syft::CancellationToken::global().cancel_requested() && !interrupted) {
+            for (const Worker& worker : workers) kill(worker.pid, SIGTERM);
+            interrupted = true;
+        }
+
+        // Wake up at the first deadline of a running worker
+        int wait_time = -1;
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        for (const Worker& worker : workers) {
+            if (timeout <= 0 || worker.killed) continue;
+            long long left = std::max<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(worker.deadline - now).count(), 0);
+            if (wait_time < 0 || left < wait_time) wait_time = static_cast<int>(std::min<long long>(left, std::numeric_limits<int>::max()));
+        }
+
+        std::vector<pollfd> polled;
+        for (const Worker& worker : workers) polled.push_back({worker.channel, POLLIN, 0});
+        if (poll(polled.data(), polled.size(), wait_time) < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error("Error: cannot wait for batch workers");
+        }
+
+        // Workers stuck past their deadline, e.g. in the translation of a formula
+        now = std::chrono::steady_clock::now();
+        for (Worker& worker : workers) {
+            if (timeout > 0 && !worker.killed && now >= worker.deadline) {
+                kill(worker.pid, SIGKILL);
+                worker.killed = true;
+            }
+        }
+
+        std::vector<Worker> running;
+        for (std::size_t j = 0; j < workers.size(); ++j) {
+            Worker& worker = workers[j];
+            if (polled[j].revents == 0) {running.push_back(worker); continue;}
+            char buffer[4096];
+            ssize_t n = read(worker.channel, buffer, sizeof(buffer));
+            if (n > 0) {worker.text.append(buffer, n); running.push_back(worker); continue;}
+            if (n < 0 && errno == EINTR) {running.push_back(worker); continue;}
+
+            close(worker.channel);
+            int wait_status = 0;
+            while (waitpid(worker.pid, &wait_status, 0) < 0 && errno == EINTR) {}
+            const BatchJob& job = jobs[worker.job];
+            std::string verdict;
+            if (parse_outcome(worker.text, outcomes[worker.job])) {
+                status[worker.job] = JobStatus::Done;
+                if (keys[worker.job] != "" && is_conclusive(outcomes[worker.job])) store->insert(keys[worker.job], outcomes[worker.job]);
+                std::cout << "[BeSyft] Job " << worker.job + 1 << " of " << jobs.size() << " (" << job.agent_file << ", " << job.environment_file << ", -t " << job.alg_id << "): " << outcomes[worker.job].verdict << " in " << sumVec(outcomes[worker.job].run_times) << " s" << std::endl;
+            } else if (!worker.killed && killed_worker_verdict(wait_status, memory_limit, verdict)) {
+                status[worker.job] = JobStatus::Done;
+                outcomes[worker.job] = {algorithm_name(job.alg_id), {}, verdict};
+                if (verdict == "CRASH") ++failed;
+                std::cerr << "[BeSyft] Job " << worker.job + 1 << " of " << jobs.size() << " (" << job.agent_file << ", " << job.environment_file << ", -t " << job.alg_id << "): " << verdict << ", killed by signal " << WTERMSIG(wait_status) << std::endl;
+            } else if (worker.killed) {
+                status[worker.job] = JobStatus::Done;
+                outcomes[worker.job] = {algorithm_name(job.alg_id), {}, "TIMEOUT"};
+                std::cout << "[BeSyft] Job " << worker.job + 1 << " of " << jobs.size() << " (" << job.agent_file << ", " << job.environment_file << ", -t " << job.alg_id << "): TIMEOUT, killed " << cancellation_grace_period << " s after its deadline" << std::endl;
+            } else {
+                status[worker.job] = JobStatus::Failed;
+                ++failed;
+                std::cerr << "[BeSyft] Job " << worker.job + 1 << " of " << jobs.size() << " (" << job.agent_file << ", " << job.environment_file << ", -t " << job.alg_id << ") failed" << std::endl;
+            }
+        }
+        workers.swap(running);
+
+        while (next_to_save < jobs.size() && status[next_to_save] != JobStatus::Pending) {
+            if (status[next_to_save] == JobStatus::Done) save_outcome(outstreams, jobs[next_to_save], outcomes[next_to_save]);
+            ++next_to_save;
+        }
+    }
+
+    // Jobs after an interruption were never started
+    for (; next_to_save < jobs.size(); ++next_to_save) {
+        if (status[next_to_save] == JobStatus::Done) save_outcome(outstreams, jobs[next_to_save], outcomes[next_to_save]);
+    }
+    if (next < order.size()) std::cout << "[BeSyft] Batch interrupted with " << order.size() - next << " jobs not started" << std::endl;
+    exit_after_grace_period = 1;
+    return failed;
+}
+
 int main(int argc, char** argv) {
 
     CLI::App app {
@@ -37,32 +995,134 @@ int main(int argc, char** argv) {
     int starting_flag, alg_id;
 
     bool print_dot = false;
-    app.add_flag("-d,--print-dot", print_dot, "Print the output function(s)");
+    CLI::Option* print_dot_opt = app.add_flag("-d,--print-dot", print_dot, "Print the output function(s)");
+
+    Syft::StrategyExtractionOptions extraction_options;
+    bool skolem = false;
+    app.add_flag("--verify-strategy", extraction_options.verify, "Verify the extracted output functions");
+    app.add_flag("--strategy-times", extraction_options.report_times, "Print the time spent on each output function");
+    app.add_flag("--skolem", skolem, "Extract one Skolem function per output instead of using SolveEqn");
+    app.add_option("--node-budget", extraction_options.node_budget, "New BDD nodes SolveEqn may create before falling back to Skolem extraction (0 = no limit)");
+    app.add_flag("--decompose-outputs", extraction_options.decompose, "Extract independent clusters of outputs separately");
+    int minimization = 0;
+    app.add_option("--minimize", minimization, "Minimize the output functions of the final strategy outside its winning reachable states:\nnone=0;\nRestrict=1;\nLICompaction=2;\nSqueeze=3.") -> check(CLI::Range(0, 3));
+    std::size_t simulate_traces = 0, trace_length = 1000;
+    CLI::Option* simulate_opt = app.add_option("--simulate", simulate_traces, "Benchmark the strategy on this many random traces");
+    app.add_option("--trace-length", trace_length, "Number of steps of each simulated trace");
+    string aiger_file = "";
+    CLI::Option* aiger_opt = app.add_option("--aiger", aiger_file, "Save the strategy as an AIGER circuit (.aig for binary, .aag for ASCII)");
+    string mealy_file = "";
+    CLI::Option* mealy_opt = app.add_option("--mealy", mealy_file, "Save the strategy as a minimal Mealy machine table in a C header");
+    double timeout = 0;
+    app.add_option("--timeout", timeout, "Stop synthesis after this many seconds and save the phases completed so far with a TIMEOUT verdict (0 = no limit)");
+    app.add_flag("--lazy-strategy", extraction_options.lazy, "Answer strategy queries on demand from the winning moves instead of extracting output functions") ->
+        excludes(print_dot_opt) -> excludes(simulate_opt) -> excludes(aiger_opt) -> excludes(mealy_opt);
    
     CLI::Option* agent_formula_opt = 
         app.add_option("-a,--agent-file", agent_file, "File to agent specification")->
-            required() -> check(CLI::ExistingFile);
+            check(CLI::ExistingFile);
 
     CLI::Option* environment_formula_file =
         app.add_option("-e,--environment-file", environment_file, "File to environment assumption")->
-            required() -> check(CLI::ExistingFile);
+            check(CLI::ExistingFile);
 
     CLI::Option* partition_file =
         app.add_option("-p,--partition-file", partition_filename, "File to partition" )->
-            required () -> check(CLI::ExistingFile);
+            check(CLI::ExistingFile);
     
     CLI::Option* starting_opt =
-        app.add_option("-s,--starting-player", starting_flag, "Starting player:\nagent=1;\nenvironment=0.")->
-            required();
+        app.add_option("-s,--starting-player", starting_flag, "Starting player:\nagent=1;\nenvironment=0.");
     
     CLI::Option* alg_id_opt =
-        app.add_option("-t,--algorithm", alg_id, "Specifies algorithm to use:\nMonolithic Best-Effort Synthesis=1;\nExplicit-Compositional Best-Effort Synthesis=2;\nSymbolic-Compositional Best-Effort Synthesis=3;\nAdversarial Reactive Synthesis=4") -> required();
+        app.add_option("-t,--algorithm", alg_id, "Specifies algorithm to use:\nMonolithic Best-Effort Synthesis=1;\nExplicit-Compositional Best-Effort Synthesis=2;\nSymbolic-Compositional Best-Effort Synthesis=3;\nAdversarial Reactive Synthesis=4;\nHybrid Explicit-Symbolic Adversarial Reactive Synthesis=5;\nBit-Parallel Explicit Adversarial Reactive Synthesis=6;\nOn-the-fly Compositional Adversarial Reactive Synthesis=7;\nAntichain Compositional Adversarial Reactive Synthesis=8;\nPortfolio of the Best-Effort Synthesis algorithms 1-3=9");
 
     CLI::Option* outfile_opt =
         app.add_option("-f,--save-results", outfile, "If specified, save results in the passed file. Stores:\nAlgorithm;\nGoal file;\nEnvironment file;\nStarting player;\nLTLf2DFA (s);\nDFA2Sym (s);\nAdv Game (s);\nCoop Game (s); \t#best-effort synthesis algorithms only\nRun time(s);\nRealizability");
 
+    string batch_file = "";
+    CLI::Option* batch_opt =
+        app.add_option("--batch", batch_file, "Run the jobs of a manifest in this process. Each line holds the arguments of -a, -e, -p, -t and -s, and optionally a results file overriding -f") ->
+            check(CLI::ExistingFile) -> excludes(agent_formula_opt) -> excludes(environment_formula_file) -> excludes(partition_file) -> excludes(starting_opt) -> excludes(alg_id_opt) ->
+            excludes(print_dot_opt) -> excludes(simulate_opt) -> excludes(aiger_opt) -> excludes(mealy_opt);
+    bool share_dfas = false;
+    CLI::Option* share_dfas_opt = app.add_flag("--share-dfas", share_dfas, "Reuse the DFAs of formulas across the symbolic-compositional jobs of a batch") -> needs(batch_opt);
+    std::size_t worker_count = 1, memory_limit = 0;
+    CLI::Option* jobs_opt = app.add_option("-j,--jobs", worker_count, "Number of batch jobs run in parallel, each in its own process") -> needs(batch_opt) -> excludes(share_dfas_opt) -> check(CLI::PositiveNumber);
+    app.add_option("--memory-limit", memory_limit, "Address space limit of each parallel batch job, in MB (0 = no limit)") -> needs(jobs_opt);
+
+    string store_file = "";
+    CLI::Option* store_opt = app.add_option("--result-store", store_file, "Record the results of batch jobs in this file") -> needs(batch_opt);
+    bool reuse_results = false;
+    app.add_flag("--reuse-results", reuse_results, "Skip batch jobs whose result is already recorded, and save the recorded result instead") -> needs(store_opt);
+
+    bool daemon = false;
+    CLI::Option* daemon_opt = app.add_flag("--daemon", daemon, "Answer JSON synthesis requests, one per line, on stdin until it is closed, keeping DFAs and BDD managers warm") ->
+        excludes(agent_formula_opt) -> excludes(environment_formula_file) -> excludes(partition_file) -> excludes(starting_opt) -> excludes(alg_id_opt) -> excludes(batch_opt) ->
+        excludes(outfile_opt) -> excludes(print_dot_opt) -> excludes(simulate_opt) -> excludes(aiger_opt) -> excludes(mealy_opt);
+    string socket_path = "";
+    app.add_option("--socket", socket_path, "Read the requests of the daemon from a UNIX domain socket at this path instead of stdin") -> needs(daemon_opt);
+    std::size_t max_sessions = 16, max_cached_dfas = 4096;
+    app.add_option("--max-sessions", max_sessions, "Number of sessions the daemon keeps warm, dropping the least recently used one (0 = no limit)") -> needs(daemon_opt);
+    app.add_option("--max-cached-dfas", max_cached_dfas, "Number of DFAs a daemon session caches before it starts afresh (0 = no limit)") -> needs(daemon_opt);
+
+    bool anytime = false, skip_cooperative = false;
+    app.add_flag("--anytime", anytime, "Print the result of each game of best-effort synthesis as soon as it is solved (-t 1, 2 and 3)");
+    app.add_flag("--skip-cooperative", skip_cooperative, "Skip the cooperative game of best-effort synthesis when the agent wins the adversarial game (-t 1, 2 and 3)");
+
+    bool dual = false;
+    app.add_flag("--dual", dual, "Solve the games with each starting player on one arena, and save a result for each (-t 3 only)") ->
+        excludes(starting_opt) -> excludes(batch_opt) -> excludes(daemon_opt) -> excludes(print_dot_opt) -> excludes(simulate_opt) -> excludes(aiger_opt) -> excludes(mealy_opt);
+
     CLI11_PARSE(app, argc, argv);
 
+    if (batch_opt->count() == 0 && !daemon && (agent_formula_opt->count() == 0 || environment_formula_file->count() == 0 || partition_file->count() == 0 || (starting_opt->count() == 0 && !dual) || alg_id_opt->count() == 0)) {
+        std::cerr << "[BeSyft] Options -a, -e, -p, -s and -t are required unless --batch or --daemon is given, and -s is replaced by --dual" << std::endl;
+        return 1;
+    }
+
+    if (dual && alg_id != 3) {
+        std::cerr << "[BeSyft] Option --dual requires the symbolic-compositional algorithm (-t 3)" << std::endl;
+        return 1;
+    }
+
+    if (skolem) {
+        extraction_options.mode = Syft::StrategyExtractionMode::Skolem;
+    }
+
+
+    Syft::AnytimeOptions anytime_options;
+    if (anytime) anytime_options.on_phase = report_phase;
+    anytime_options.skip_cooperative_if_winning = skip_cooperative;
+
+    // SIGTERM, sent by timeout(1), also stops synthesis cleanly
+    std::signal(SIGINT, cancel_synthesis);
+    std::signal(SIGTERM, cancel_synthesis);
+    std::signal(SIGALRM, cancel_synthesis);
+
+    if (daemon) {
+        Syft::SynthesisDaemon synthesis_daemon(extraction_options, timeout, static_cast<Syft::DontCareMinimization>(minimization), max_sessions, max_cached_dfas);
+        if (socket_path != "") {
+            synthesis_daemon.serve_socket(socket_path);
+        } else {
+            // Responses take the place of the logs on stdout
+            std::ostream responses(std::cout.rdbuf());
+            std::cout.rdbuf(std::cerr.rdbuf());
+            synthesis_daemon.serve(std::cin, responses);
+            std::cout.rdbuf(responses.rdbuf());
+        }
+        std::cout << "[BeSyft] Daemon stopped after " << synthesis_daemon.request_count() << " requests" << std::endl;
+        return 0;
+    }
+
+    if (batch_file != "") {
+        std::unique_ptr<Syft::ResultStore> store;
+        if (store_file != "") store.reset(new Syft::ResultStore(store_file));
+        std::size_t failed = jobs_opt->count() > 0 ?
+            run_parallel_batch(batch_file, outfile, worker_count, memory_limit, timeout, extraction_options, store.get(), reuse_results) :
+            run_batch(batch_file, outfile, share_dfas, timeout, extraction_options, store.get(), reuse_results);
+        return failed == 0 ? 0 : 1;
+    }
+
     string agent_specification;
     ifstream agent_spec_stream(agent_file);
     getline(agent_spec_stream, agent_specification);
@@ -76,6 +1136,19 @@ int main(int argc, char** argv) {
     Syft::InputOutputPartition partition =
         Syft::InputOutputPartition::read_from_file(partition_filename);
 
+    if (dual) {
+        if (timeout > 0) Syft::CancellationToken::global().set_deadline(timeout);
+        std::pair<SynthesisOutcome, SynthesisOutcome> outcomes = run_dual(agent_specification, environment_assumption, partition, extraction_options, anytime_options);
+        std::cout << "[BeSyft] Agent first: " << outcomes.first.verdict << "; environment first: " << outcomes.second.verdict << std::endl;
+        std::cout << "[BeSyft] Running time: " << sumVec(outcomes.first.run_times) + sumVec(outcomes.second.run_times) << " s" << std::endl;
+        if (outfile != "") {
+            std::ofstream outstream(outfile, std::ifstream::app);
+            write_outcome(outstream, outcomes.first, agent_file, environment_file, 1);
+            write_outcome(outstream, outcomes.second, agent_file, environment_file, 0);
+        }
+        return 0;
+    }
+
     Syft::Player starting_player;
     if (starting_flag == 1) {
         starting_player = Syft::Player::Agent;
@@ -83,142 +1156,38 @@ int main(int argc, char** argv) {
         starting_player = Syft::Player::Environment;
     }
 
-    std::shared_ptr<Syft::VarMgr> v_mgr = std::make_shared<Syft::VarMgr>();
+    StrategyOutputs strategy_outputs;
+    strategy_outputs.print_dot = print_dot;
+    strategy_outputs.simulate_traces = simulate_traces;
+    strategy_outputs.trace_length = trace_length;
+    strategy_outputs.aiger_file = aiger_file;
+    strategy_outputs.mealy_file = mealy_file;
+    strategy_outputs.minimization = static_cast<Syft::DontCareMinimization>(minimization);
 
     cout << "[BeSyft] Ready to start best-effort synthesis" << endl;
 
-    if (alg_id == 1) {
-        Syft::MonolithicBestEffortSynthesizer best_effort_synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player);
-        auto result = best_effort_synthesizer.run();
-        auto run_times = best_effort_synthesizer.get_running_times();
-        std::cout << "[BeSyft] Running time: " << sumVec(run_times) << " s" << std::endl;
-        if (result.first.realizability) {
-            std::cout << "[BeSyft] Adversarially realizable. Computed winning strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.first.transducer.get() -> dump_dot("adv_outfunct.dot");}
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Monolithic Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << sumVec(run_times) << ",Adv" << std::endl;
-                }
-            }
-        else if (result.second.realizability) {
-            std::cout << "[BeSyft] Cooperatively realizable. Computed best-effort strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output functions" << std::endl; result.first.transducer.get() -> dump_dot("adv_outfunct.dot"); result.second.transducer.get() -> dump_dot("coop_outfunct");}
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Monolithic Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << sumVec(run_times) << ",Coop" << std::endl;
-                }
-            } 
-        else if (!result.first.realizability && !result.second.realizability) { 
-            std::cout << "[BeSyft] Unrealizable. Computed best-effort strategy" << std::endl;
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Monolithic Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << sumVec(run_times) << ",Unr" << std::endl;
-            }
-        }
-    } 
-    else if (alg_id == 2) {
-        Syft::ExplicitCompositionalBestEffortSynthesizer best_effort_synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player);
-        auto result = best_effort_synthesizer.run();
-        auto run_times = best_effort_synthesizer.get_running_times();
-        std::cout << "[BeSyft] Running time: " << sumVec(run_times) << " s" << std::endl;
-        if (result.first.realizability) {
-            std::cout << "[BeSyft] Adversarially realizable. Computed winning strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.first.transducer.get() -> dump_dot("adv_outfunct.dot");}
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Explicit-Compositional Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << sumVec(run_times) << ",Adv" << std::endl;
-                }
-        } else if (result.second.realizability) {
-            std::cout << "[BeSyft] Cooperatively realizable. Computed best-effort strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output functions" << std::endl; result.first.transducer.get() -> dump_dot("adv_outfunct.dot"); result.second.transducer.get() -> dump_dot("coop_outfunct");}
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Explicit-Compositional Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << sumVec(run_times) << ",Coop" << std::endl;
-                }
-            }
-        else if (!result.first.realizability && !result.second.realizability) { 
-            std::cout << "[BeSyft] Unrealizable." << std::endl;
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Explicit-Compositional Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << sumVec(run_times) << ",Unr" << std::endl;
-                }
-            }    
-        } 
-    else if (alg_id == 3) {
-        Syft::SymbolicCompositionalBestEffortSynthesizer best_effort_synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player);
-        auto result = best_effort_synthesizer.run();
-        auto run_times = best_effort_synthesizer.get_running_times();
-        std::cout << "[BeSyft] Running time: " << sumVec(run_times) << " s" << std::endl;
-        if (result.first.realizability) {
-            std::cout << "[BeSyft] Adversarially realizable. Computed winning strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.first.transducer.get() -> dump_dot("adv_outfunct.dot");}
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Symbolic-Compositional Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << sumVec(run_times) << ",Adv" << std::endl;
-                }
-        } else if (result.second.realizability) {
-            std::cout << "[BeSyft] Cooperatively realizable. Computed best-effort strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output functions" << std::endl; result.first.transducer.get() -> dump_dot("adv_outfunct.dot"); result.second.transducer.get() -> dump_dot("coop_outfunct");}
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Symbolic-Compositional Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << sumVec(run_times) << ",Coop" << std::endl;
-                }
-            }
-        else if (!result.first.realizability && !result.second.realizability) { 
-            std::cout << "[BeSyft] Unrealizable." << std::endl;
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Symbolic-Compositional Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << sumVec(run_times) << ",Unr" << std::endl;
-                }
-        }
-    }
-    else if (alg_id == 4) {
-        Syft::AdversarialSynthesizer adv_synth(v_mgr, agent_specification, environment_assumption, partition, starting_player);
-        auto result = adv_synth.run();
-        auto run_times = adv_synth.get_running_times();
-        std::cout << "[BeSyft] Running time: " << sumVec(run_times) << " s" << std::endl;
-        if (result.realizability) {
-            std::cout << "[BeSyft] Adversarially realizable. Computed winning strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.transducer.get() -> dump_dot("adv_outfunct.dot");}
-            if (outfile != "") {
-                std::ofstream outstream(outfile, std::ifstream::app);
-                outstream << "Adversarial Synthesizer," << agent_file << "," << environment_file << ",";
-                if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << ",NA," << sumVec(run_times) << ",Adv" << std::endl;
-            }
-        } else {
-            std::cout << "[BeSyft] Not adversarially realizable." << std::endl;
-            if (outfile != "") {
-                std::ofstream outstream(outfile, std::ifstream::app);
-                outstream << "Adversarial Synthesizer," << agent_file << "," << environment_file << ",";
-                if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << ",NA,"  << sumVec(run_times) << ",Unr" << std::endl;
-            }
-        }        
-    } 
-    else {
-        std::cerr << "[BeSyft] Non-existing algorithm. Terminating" << std::endl;
+    if (timeout > 0) Syft::CancellationToken::global().set_deadline(timeout);
+
+    SynthesisOutcome outcome;
+    try {
+        outcome = run_algorithm(alg_id, agent_specification, environment_assumption, partition, starting_player, extraction_options, anytime_options, &strategy_outputs);
+        if (alg_id == 9) std::cout << "[BeSyft] Portfolio winner: " << outcome.algorithm << std::endl;
+        std::cout << "[BeSyft] Running time: " << sumVec(outcome.run_times) << " s" << std::endl;
+        std::cout << "[BeSyft] " << describe_verdict(outcome, alg_id) << std::endl;
+    } catch (const Syft::SynthesisTimeout& timeout) {
+        outcome = {algorithm_name(alg_id), timeout.running_times(), "TIMEOUT"};
+        std::cout << "[BeSyft] Timed out after " << outcome.run_times.size() << " completed phases (" << sumVec(outcome.run_times) << " s)" << std::endl;
+    } catch (const std::runtime_error& error) {
+        std::cerr << "[BeSyft] " << error.what() << ". Terminating" << std::endl;
         return 1;
     }
 
+    // The cooperative game is missing from best-effort results if it was skipped
+    if (outfile != "") {
+        std::ofstream outstream(outfile, std::ifstream::app);
+        write_outcome(outstream, outcome, agent_file, environment_file, starting_flag);
+    }
+
     return 0;
 
 }
@@ -28,6 +28,8 @@ namespace Syft {
 
 			Player starting_player_;
 
+			StrategyExtractionOptions extraction_options_;
+
 			std::vector<SymbolicStateDfa> symbolic_dfa_;
 
 			InputOutputPartition partition_;
@@ -43,13 +45,15 @@ namespace Syft {
 			* \param environment_assumption LTLf environment specification in Lydia syntax
 			* \param partition Partitioning of problem variables
 			* \param starting_player Player who moves first each turn
+			* \param extraction_options Options for extracting output functions
 			* 
 			*/
 			AdversarialSynthesizer(std::shared_ptr<VarMgr> var_mgr,
 									std::string agent_specification,
 									std::string environment_specification,
 									InputOutputPartition partition,
-									Player starting_player);
+									Player starting_player,
+									StrategyExtractionOptions extraction_options = StrategyExtractionOptions());
 			
 			/**
 			 * @brief Solves symbolic DFA games to compute adversarially and cooperatively winning strategies
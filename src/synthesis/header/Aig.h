@@ -0,0 +1,118 @@
+#ifndef AIG_H
+#define AIG_H
+
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Syft {
+
+/**
+ * \brief A sequential And-Inverter Graph with structural hashing.
+ *
+ * Literals follow the AIGER convention: literal 2v is variable v, 2v + 1 is
+ * its negation, and variable 0 is the constant false. Variables are numbered
+ * inputs first, then latches, then AND gates in topological order, so all
+ * inputs and latches must be added before the first AND gate.
+ *
+ * AND gates are simplified when they are created: constants are propagated,
+ * a & a and a & !a are folded, and structurally equal gates are shared.
+ */
+class Aig {
+ public:
+
+  using Literal = unsigned int;
+
+  static constexpr Literal false_literal = 0;
+  static constexpr Literal true_literal = 1;
+
+ private:
+
+  struct AndGate {
+    Literal left;
+    Literal right;
+  };
+
+  struct Latch {
+    Literal next;
+    bool initial_value;
+  };
+
+  std::vector<std::string> input_names_;
+  std::vector<std::string> latch_names_;
+  std::vector<Latch> latches_;
+  std::vector<std::string> output_names_;
+  std::vector<Literal> outputs_;
+  std::vector<AndGate> and_gates_;
+  // Number of AND gates on the longest path from an input or latch
+  std::vector<std::size_t> levels_;
+  std::unordered_map<unsigned long long, Literal> strash_;
+
+  unsigned int first_and_variable() const;
+
+  bool is_and(unsigned int variable) const;
+
+  const AndGate& and_gate(unsigned int variable) const;
+
+  std::size_t level(Literal literal) const;
+
+ public:
+
+  Literal add_input(const std::string& name);
+
+  Literal add_latch(const std::string& name, bool initial_value);
+
+  void set_latch_next(std::size_t latch, Literal next);
+
+  void add_output(const std::string& name, Literal literal);
+
+  Literal make_and(Literal left, Literal right);
+
+  Literal make_or(Literal left, Literal right);
+
+  /**
+   * \brief Returns a literal for "if \a selector then \a then_literal else \a else_literal".
+   */
+  Literal make_mux(Literal selector, Literal then_literal, Literal else_literal);
+
+  /**
+   * \brief Returns an equivalent graph with balanced AND trees and without unused gates.
+   *
+   * Every maximal tree of single-fanout, non-negated AND gates is rebuilt by
+   * combining its two shallowest leaves first, which minimizes its depth.
+   */
+  Aig balance() const;
+
+  std::size_t input_count() const;
+
+  std::size_t latch_count() const;
+
+  std::size_t output_count() const;
+
+  std::size_t and_count() const;
+
+  /**
+   * \brief Returns the number of AND gates on the longest path of the graph.
+   */
+  std::size_t depth() const;
+
+  /**
+   * \brief Saves the graph in the ASCII AIGER format (.aag).
+   */
+  void write_ascii(const std::string& filename) const;
+
+  /**
+   * \brief Writes the graph in the ASCII AIGER format to a stream.
+   */
+  void write_ascii(std::ostream& out) const;
+
+  /**
+   * \brief Saves the graph in the binary AIGER format (.aig).
+   */
+  void write_binary(const std::string& filename) const;
+};
+
+}
+
+#endif // AIG_H
@@ -0,0 +1,134 @@
+#ifndef ANTICHAIN_REACHABILITY_SYNTHESIZER_H
+#define ANTICHAIN_REACHABILITY_SYNTHESIZER_H
+
+#include <unordered_map>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "ExplicitComponentProduct.h"
+#include "Synthesizer.h"
+
+namespace Syft {
+
+/**
+ * \brief A synthesizer that solves the adversarial game over A_phi x A_E x A_tt
+ * with antichains of component-state tuples.
+ *
+ * Each component is preordered by language inclusion of its states. A tuple
+ * t is at least as good as s for the agent when the A_phi and A_tt states of
+ * t accept more than those of s and the A_E state of t accepts less. The goal
+ * and every controllable predecessor of an upward-closed set are upward
+ * closed for this order, so the winning region is computed backward from the
+ * goal as an antichain of minimal tuples, without building the product.
+ *
+ * The controllable predecessor of one tuple on one letter class is a box,
+ * the product of one upward-closed set per component obtained from the
+ * inverted component successor tables. The letter quantifiers become unions
+ * and intersections of boxes, whose minimal tuples extend the antichain.
+ */
+class AntichainReachabilitySynthesizer : public Synthesizer<ExplicitComponentProduct> {
+ public:
+
+  using ProductState = ExplicitComponentProduct::ProductState;
+
+ private:
+
+  // One upward-closed set of states per component
+  using Box = std::vector<boost::dynamic_bitset<>>;
+
+  // includes_[c][p][q] iff the language of state p of component c is
+  // included in the language of state q
+  std::vector<std::vector<boost::dynamic_bitset<>>> includes_;
+  // Smallest state of the same component with the same language
+  std::vector<std::vector<std::size_t>> representatives_;
+  // upward_closures_[c][q] holds the states of component c at least as good as q
+  std::vector<std::vector<boost::dynamic_bitset<>>> upward_closures_;
+  // Predecessors of each upward closure, keyed by q * letter_count + letter
+  mutable std::vector<std::unordered_map<std::size_t, boost::dynamic_bitset<>>>
+      predecessor_closures_;
+
+  mutable std::vector<std::size_t> winning_antichain_sizes_;
+
+  void compute_inclusion(std::size_t c);
+
+  /**
+   * \brief Returns true iff \a better is at least as good as \a worse for the agent.
+   */
+  bool subsumes(const ProductState& better, const ProductState& worse) const;
+
+  bool covered(const std::vector<ProductState>& antichain,
+               const ProductState& state) const;
+
+  /**
+   * \brief Adds \a state to the antichain unless it is covered, dropping the tuples it subsumes.
+   *
+   * \return True iff the antichain changed.
+   */
+  bool insert(std::vector<ProductState>& antichain, const ProductState& state) const;
+
+  /**
+   * \brief Returns the states of component \a c moving into the upward closure of \a state on a letter class.
+   */
+  const boost::dynamic_bitset<>& predecessor_closure(std::size_t c,
+                                                     std::size_t state,
+                                                     std::size_t outer,
+                                                     std::size_t inner) const;
+
+  /**
+   * \brief Returns, for each tuple of the antichain, the box of tuples moving into its upward closure on a letter class.
+   */
+  std::vector<Box> predecessor_boxes(const std::vector<ProductState>& antichain,
+                                     std::size_t outer,
+                                     std::size_t inner) const;
+
+  /**
+   * \brief Adds \a box to the union \a boxes unless a box of the union contains it.
+   */
+  static void add_box(std::vector<Box>& boxes, Box box);
+
+  /**
+   * \brief Returns the pairwise intersections of two unions of boxes.
+   */
+  static std::vector<Box> intersect(const std::vector<Box>& first,
+                                    const std::vector<Box>& second);
+
+  /**
+   * \brief Returns the minimal tuples of a box, one state per language in each component.
+   */
+  std::vector<ProductState> minimal_tuples(const Box& box) const;
+
+ public:
+
+  /**
+   * \brief Construct a synthesizer for the agent in the given product game.
+   *
+   * Computes the language-inclusion preorder of every component.
+   *
+   * \param spec The product of the component DFAs. The agent must reach a
+   *   state satisfying ExplicitComponentProduct::is_goal.
+   */
+  AntichainReachabilitySynthesizer(ExplicitComponentProduct spec);
+
+  /**
+   * \brief Solves the game from the initial state.
+   *
+   * Prints the size of the winning antichain after each iteration, and stops
+   * as soon as the antichain covers the initial state.
+   *
+   * \return The result consists of
+   * realizability
+   * the agent winning states found, the upward closure of the winning
+   * antichain, encoded over fresh state variables for each component
+   * nullptr in place of the transducer, since no strategy is extracted.
+   */
+  virtual SynthesisResult run() const final;
+
+  /**
+   * \brief Returns the size of the winning antichain after each iteration of the last call to run.
+   */
+  std::vector<std::size_t> winning_antichain_sizes() const;
+};
+
+}
+
+#endif // ANTICHAIN_REACHABILITY_SYNTHESIZER_H
@@ -0,0 +1,51 @@
+#ifndef ANYTIME_OPTIONS_H
+#define ANYTIME_OPTIONS_H
+
+#include <functional>
+
+#include "Synthesizer.h"
+
+namespace Syft {
+
+/**
+ * \brief A game of best-effort synthesis.
+ */
+enum class BestEffortPhase {Adversarial, Cooperative};
+
+/**
+ * \brief Options for reporting the games of best-effort synthesis as they are solved.
+ */
+struct AnytimeOptions {
+  /**
+   * \brief Called with the result and running time, in seconds, of each game as soon as it is solved.
+   *
+   * The adversarial result answers whether the goal is realizable before the
+   * cooperative game starts. The result is owned by the synthesizer.
+   */
+  std::function<void(BestEffortPhase, const SynthesisResult&, double)> on_phase;
+
+  /**
+   * \brief Skip the negated-environment and cooperative games when the adversarial game is won from the initial state.
+   *
+   * The cooperative result then reuses the adversarial winning states and
+   * strategy, which is a best-effort strategy from the initial state, and no
+   * cooperative game time is recorded.
+   */
+  bool skip_cooperative_if_winning = false;
+
+  /**
+   * \brief Calls on_phase, if set.
+   */
+  void report(BestEffortPhase phase,
+              const SynthesisResult& result,
+              double running_time) const;
+
+  /**
+   * \brief Returns a cooperative result with the winning states and strategy of an adversarially winning result.
+   */
+  static SynthesisResult cooperative_from_adversarial(const SynthesisResult& adversarial_result);
+};
+
+}
+
+#endif // ANYTIME_OPTIONS_H
@@ -0,0 +1,61 @@
+#ifndef BEST_EFFORT_TRANSDUCER_H
+#define BEST_EFFORT_TRANSDUCER_H
+
+#include "Synthesizer.h"
+#include "Transducer.h"
+
+namespace Syft {
+
+/**
+ * \brief A transducer representing a best-effort strategy.
+ *
+ * Follows the adversarial strategy in the adversarially winning states and
+ * the cooperative strategy in the states that are only cooperatively
+ * winning. The two strategies are composed once, when the transducer is
+ * constructed, and the result behaves like any other transducer.
+ */
+class BestEffortTransducer : public Transducer {
+ private:
+
+  CUDD::BDD adversarial_winning_states_;
+  CUDD::BDD cooperative_winning_states_;
+
+ public:
+
+  /**
+   * \brief Merges the results of the adversarial and cooperative games into a best-effort strategy.
+   *
+   * Both results must come from games over the same arena and have a transducer.
+   *
+   * \param adversarial_result Reactive synthesis result.
+   * \param cooperative_result Cooperative synthesis result.
+   */
+  BestEffortTransducer(const SynthesisResult& adversarial_result,
+                       const SynthesisResult& cooperative_result);
+
+  using Transducer::minimize;
+
+  /**
+   * \brief Simplifies every output function outside the reachable states that are winning in either game.
+   */
+  void minimize(DontCareMinimization method);
+
+  /**
+   * \brief Returns the states that are adversarially or cooperatively winning.
+   */
+  CUDD::BDD winning_states() const;
+
+  /**
+   * \brief Returns the states that are adversarially winning.
+   */
+  CUDD::BDD adversarial_winning_states() const;
+
+  /**
+   * \brief Returns the states that are cooperatively, but not adversarially, winning.
+   */
+  CUDD::BDD cooperative_only_winning_states() const;
+};
+
+}
+
+#endif // BEST_EFFORT_TRANSDUCER_H
@@ -0,0 +1,112 @@
+#ifndef BIT_PARALLEL_REACHABILITY_SYNTHESIZER_H
+#define BIT_PARALLEL_REACHABILITY_SYNTHESIZER_H
+
+#include <cstdint>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "ExplicitStateDfa.h"
+#include "LetterClasses.h"
+#include "Player.h"
+#include "Synthesizer.h"
+
+namespace Syft {
+
+/**
+ * \brief An explicit synthesizer for reachability games over small alphabets.
+ *
+ * The transition ADD of every state is expanded into one successor per
+ * letter class, where the classes are the products of the input and output
+ * classes computed by LetterClasses, and the table is inverted into the
+ * predecessors of each state on each letter class. Sets of states are
+ * bitsets stored in 64-bit words. For each letter class the solver keeps the
+ * states whose successor is winning, updated from the predecessors of the
+ * states won in the last iteration, and the controllable predecessor is the
+ * AND/OR reduction of these bitsets over the letters, 64 states at a time.
+ * Each iteration only reduces the words holding a predecessor of a new winner.
+ */
+class BitParallelReachabilitySynthesizer : public Synthesizer<ExplicitStateDfa> {
+ public:
+
+  using Word = boost::dynamic_bitset<>::block_type;
+
+  /**
+   * \brief Largest size of the predecessor table, in bytes.
+   */
+  static constexpr std::size_t max_table_bytes = std::size_t(1) << 30;
+
+ private:
+
+  std::shared_ptr<VarMgr> var_mgr_;
+  Player starting_player_;
+  Player protagonist_player_;
+  std::vector<std::size_t> goal_states_;
+  // State variables encoding the winning region returned by run
+  std::size_t winning_state_automaton_id_;
+
+  std::size_t outer_letter_count_;
+  std::size_t inner_letter_count_;
+  bool outer_exists_;
+  bool inner_exists_;
+
+  // The predecessors of state q on letter class l, with l the outer class
+  // times inner_letter_count_ plus the inner class, are
+  // predecessor_states_[predecessor_offsets_[l * state_count + q]] up to
+  // the next offset
+  std::vector<std::uint32_t> predecessor_offsets_;
+  std::vector<std::uint32_t> predecessor_states_;
+
+  /**
+   * \brief Returns the word \a word of the controllable predecessor.
+   *
+   * \param letter_words For each letter class, the bitset of the states whose
+   *   successor on that class is winning.
+   * \param word_count The number of words of each bitset.
+   */
+  Word controllable_word(const std::vector<Word>& letter_words,
+                         std::size_t word_count,
+                         std::size_t word) const;
+
+ public:
+
+  /**
+   * \brief Construct a synthesizer for the given reachability game.
+   *
+   * Throws an exception if the predecessor table, with one offset and one
+   * predecessor per state and letter class, would take more than
+   * \a max_table_bytes.
+   *
+   * \param spec An explicit-state DFA representing the game's arena.
+   * \param starting_player The player that moves first each turn.
+   * \param protagonist_player The player that must reach the goal.
+   * \param goal_states The set of states that the protagonist must reach.
+   */
+  BitParallelReachabilitySynthesizer(ExplicitStateDfa spec,
+                                     Player starting_player,
+                                     Player protagonist_player,
+                                     std::vector<std::size_t> goal_states);
+
+  /**
+   * \brief Computes the attractor of the goal states.
+   *
+   * \param stop_at_initial If true, stops as soon as the initial state is
+   *   found to be winning.
+   * \return A bitset whose \a i-th bit is set iff state \a i is winning.
+   */
+  boost::dynamic_bitset<> winning_region(bool stop_at_initial = false) const;
+
+  /**
+   * \brief Solves the reachability game.
+   *
+   * \return The result consists of
+   * realizability
+   * a set of agent winning states, encoded over state variables created
+   * once per synthesizer
+   * nullptr in place of the transducer, since no strategy is extracted.
+   */
+  virtual SynthesisResult run() const final;
+};
+
+}
+
+#endif // BIT_PARALLEL_REACHABILITY_SYNTHESIZER_H
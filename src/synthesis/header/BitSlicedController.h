@@ -0,0 +1,120 @@
+#ifndef BIT_SLICED_CONTROLLER_H
+#define BIT_SLICED_CONTROLLER_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Transducer.h"
+
+namespace Syft {
+
+/**
+ * \brief Runs a transducer on many traces at once, one trace per bit.
+ *
+ * The output and transition BDDs are compiled into a straight-line network of
+ * multiplexers, one per BDD node, in topological order. Every value in the
+ * network is a Slice that holds the value of the node in lane_count
+ * independent traces, so one pass over the network advances all of them by
+ * one step. A slice is four 64-bit words evaluated with AVX2 instructions when
+ * the compiler targets AVX2, and a single 64-bit word otherwise.
+ *
+ * Traces use the same layout as in TransducerExecutor.
+ */
+class BitSlicedController {
+ public:
+
+#if defined(__AVX2__)
+  static constexpr std::size_t slice_words = 4;
+#else
+  static constexpr std::size_t slice_words = 1;
+#endif
+
+  static constexpr std::size_t lane_count = 64 * slice_words;
+
+  struct alignas(32) Slice {
+    std::uint64_t words[slice_words];
+  };
+
+ private:
+
+  /**
+   * \brief A multiplexer of the network.
+   *
+   * Operands are positions of earlier multiplexers, position 0 being the
+   * constant 1. The masks are all ones when the operand is complemented.
+   */
+  struct Mux {
+    std::uint32_t variable;
+    std::uint32_t then_operand;
+    std::uint32_t else_operand;
+    std::uint64_t then_mask;
+    std::uint64_t else_mask;
+  };
+
+  std::vector<Mux> network_;
+  // Multiplexers [1, output_network_end_) only feed the output functions
+  std::size_t output_network_end_;
+
+  std::vector<std::uint32_t> input_indices_;
+  std::vector<std::uint32_t> output_indices_;
+  std::vector<std::uint32_t> state_indices_;
+  std::vector<std::uint32_t> output_roots_;
+  std::vector<std::uint32_t> transition_roots_;
+  std::vector<std::uint8_t> initial_state_;
+
+  std::vector<Slice> valuation_;
+  std::vector<Slice> values_;
+  std::vector<Slice> next_state_;
+
+  std::uint32_t compile(DdNode* node,
+                        std::unordered_map<DdNode*, std::uint32_t>& positions);
+
+  void evaluate(std::size_t begin, std::size_t end);
+
+  Slice root_value(std::uint32_t root) const;
+
+ public:
+
+  /**
+   * \brief Compiles the functions of a transducer and sets every lane to its initial state.
+   */
+  explicit BitSlicedController(const Transducer& transducer);
+
+  /**
+   * \brief Returns every lane to the initial state of the transducer.
+   */
+  void reset();
+
+  /**
+   * \brief Advances every lane by one step.
+   *
+   * \param inputs input_count() slices, one per input variable.
+   * \param outputs output_count() slices, one per output variable.
+   */
+  void step(const Slice* inputs, Slice* outputs);
+
+  /**
+   * \brief Runs every trace from the initial state, lane_count traces at a time.
+   *
+   * Traces may have different lengths. Throws std::invalid_argument if a
+   * trace ends in the middle of a letter, as TransducerExecutor::run does.
+   *
+   * \return The output letters of each trace, one after the other.
+   */
+  std::vector<std::vector<std::uint8_t>> run_batch(
+      const std::vector<std::vector<std::uint8_t>>& traces);
+
+  std::size_t input_count() const;
+
+  std::size_t output_count() const;
+
+  /**
+   * \brief Returns the number of multiplexers in the network.
+   */
+  std::size_t mux_count() const;
+};
+
+}
+
+#endif // BIT_SLICED_CONTROLLER_H
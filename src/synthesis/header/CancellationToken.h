@@ -0,0 +1,134 @@
+#ifndef CANCELLATION_TOKEN_H
+#define CANCELLATION_TOKEN_H
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+namespace Syft {
+
+/**
+ * \brief Thrown when synthesis is cancelled or runs past its deadline.
+ *
+ * Carries the running times of the phases completed before the timeout, as
+ * recorded by the open RunningTimesScope objects when it is thrown.
+ */
+class SynthesisTimeout : public std::runtime_error {
+ private:
+
+  std::vector<double> running_times_;
+
+ public:
+
+  SynthesisTimeout();
+
+  /**
+   * \brief Returns the running times of the phases completed before the timeout.
+   */
+  const std::vector<double>& running_times() const;
+};
+
+/**
+ * \brief Reports the running times of a synthesizer in any SynthesisTimeout
+ * thrown while the scope is open.
+ *
+ * Synthesizers open one at the start of each constructor and run() that
+ * records phases. Scopes nest, e.g. a SynthesisSession around the synthesizer
+ * it runs, and a timeout reports the times of the outermost scope first.
+ */
+class RunningTimesScope {
+ private:
+
+  static std::vector<const std::vector<double>*>& open_scopes();
+
+ public:
+
+  explicit RunningTimesScope(const std::vector<double>& running_times);
+  ~RunningTimesScope();
+
+  RunningTimesScope(const RunningTimesScope&) = delete;
+  RunningTimesScope& operator=(const RunningTimesScope&) = delete;
+
+  /**
+   * \brief Returns the running times of the open scopes, outermost first.
+   */
+  static std::vector<double> running_times();
+};
+
+/**
+ * \brief Cooperative cancellation of synthesis.
+ *
+ * DFA construction, the symbolic encoding and the game solvers poll the token
+ * between steps and stop with a SynthesisTimeout once it is cancelled or its
+ * deadline has passed. CUDD polls it as well while it builds new nodes, see
+ * VarMgr::watch_cancellation, so a single long BDD operation stops too. There
+ * is a single token per process, like the MONA and CUDD state the steps work
+ * on.
+ */
+class CancellationToken {
+ private:
+
+  std::atomic<bool> cancelled_;
+  bool has_deadline_;
+  std::chrono::steady_clock::time_point deadline_;
+  unsigned int poll_count_;
+
+  // Calls of poll() between two reads of the clock
+  static constexpr unsigned int poll_interval = 1024;
+
+  CancellationToken();
+
+ public:
+
+  CancellationToken(const CancellationToken&) = delete;
+  CancellationToken& operator=(const CancellationToken&) = delete;
+
+  /**
+   * \brief Returns the token polled by synthesis.
+   */
+  static CancellationToken& global();
+
+  /**
+   * \brief Requests cancellation.
+   *
+   * Safe to call from a signal handler.
+   */
+  void cancel();
+
+  /**
+   * \brief Cancels synthesis once the given number of seconds has elapsed from now.
+   */
+  void set_deadline(double seconds);
+
+  /**
+   * \brief Removes the deadline set by set_deadline().
+   */
+  void clear_deadline();
+
+  /**
+   * \brief Returns whether cancellation was requested or the deadline has passed.
+   */
+  bool cancelled() const;
+
+  /**
+   * \brief Returns cancelled(), reading the clock only once every poll_interval calls.
+   *
+   * For callbacks run at a high rate, such as the CUDD termination callback.
+   */
+  bool poll();
+
+  /**
+   * \brief Returns whether cancel() was called, regardless of the deadline.
+   */
+  bool cancel_requested() const;
+
+  /**
+   * \brief Throws a SynthesisTimeout if cancelled() holds.
+   */
+  void check() const;
+};
+
+}
+
+#endif // CANCELLATION_TOKEN_H
@@ -6,6 +6,7 @@
 #define CO_OP_DFA_GAME_SYNTHESIZER_H
 
 #include"Quantification.h"
+#include"StrategyExtractor.h"
 #include"SymbolicStateDfa.h"
 #include"Synthesizer.h"
 #include"Transducer.h"
@@ -22,17 +23,19 @@ namespace Syft {
             std::vector<CUDD::BDD> transition_vector_;
             std::unique_ptr<Quantification> quantify_independent_variables_;
             std::unique_ptr<Quantification> quantify_non_state_variables_;
+            StrategyExtractionOptions extraction_options_;
 
             CUDD::BDD preimage(const CUDD::BDD &winning_states) const;  // Used to compute function t in symbolic synthesis
 
             CUDD::BDD project_into_states(const CUDD::BDD &winning_moves) const;    // Used to compute function w in symbolic synthesis
 
-            std::unordered_map<int, CUDD::BDD> synthesize_strategy(const CUDD::BDD &winning_moves) const;
+            void attach_strategy(SynthesisResult &result, const CUDD::BDD &winning_moves) const;   // See StrategyExtractor::attach_strategy
 
             bool includes_initial_state(const CUDD::BDD &winning_states) const;
 
             public:
-                CoOperativeDfaGameSynthesizer(SymbolicStateDfa spec, Player starting_player, Player protagonist_player);
+                CoOperativeDfaGameSynthesizer(SymbolicStateDfa spec, Player starting_player, Player protagonist_player,
+                                              StrategyExtractionOptions extraction_options = StrategyExtractionOptions());
 
                 virtual SynthesisResult run()
                     const override = 0;
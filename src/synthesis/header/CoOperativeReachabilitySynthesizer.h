@@ -22,9 +22,11 @@ class CoOperativeReachabilitySynthesizer : public CoOperativeDfaGameSynthesizer
    * \param spec A symbolic-state DFA representing the reachability game.
    * \param starting_player The player that moves first each turn.
    * \param goal_states The set of states that the agent must reach to win.
+   * \param extraction_options Options for extracting the output functions.
    */
   CoOperativeReachabilitySynthesizer(SymbolicStateDfa spec, Player starting_player, Player protagonist_player,
-			  CUDD::BDD goal_states, CUDD::BDD state_space);
+			  CUDD::BDD goal_states, CUDD::BDD state_space,
+			  StrategyExtractionOptions extraction_options = StrategyExtractionOptions());
 
     /**
      * \brief Solves the reachability game.
@@ -0,0 +1,82 @@
+/*
+* This header declares the class ComponentAdversarialSynthesizer
+* which implements reactive synthesis under environment assumptions
+* by solving the game over the product of the component DFAs
+* without building the product
+*/
+
+#ifndef SYFT_COMPONENTADVERSARIALSYNTHESIZER_H
+#define SYFT_COMPONENTADVERSARIALSYNTHESIZER_H
+
+#include"ExplicitStateDfaMona.h"
+#include"ExplicitStateDfa.h"
+#include"AntichainReachabilitySynthesizer.h"
+#include"ExplicitComponentProduct.h"
+#include"OnTheFlyReachabilitySynthesizer.h"
+#include"InputOutputPartition.h"
+#include"Stopwatch.h"
+#include"spotparser.h"
+
+namespace Syft {
+
+	/**
+	 * \brief Engine used to solve the game over the product of the components.
+	 *
+	 * OnTheFly stops as soon as the initial state is decided, Antichain prunes
+	 * the product with language inclusion between component states.
+	 */
+	enum class ComponentGameSolver {OnTheFly, Antichain};
+
+	class ComponentAdversarialSynthesizer {
+	
+		protected:
+			std::shared_ptr<Syft::VarMgr> var_mgr_;
+
+			std::string agent_specification_;
+			std::string environment_specification_;
+
+			Player starting_player_;
+
+			ComponentGameSolver solver_;
+
+			std::vector<ExplicitStateDfa> explicit_dfas_;
+
+			InputOutputPartition partition_;
+
+			std::vector<double> running_times_;
+		public:
+		
+			/**
+			* \brief Construct an object presenting the reactive synthesis problem (E, Phi)
+			* 
+			* \param var_mgr Dictionary storing variables of the problem
+			* \param agent_specification LTLf agent goal in Lydia syntax
+			* \param environment_assumption LTLf environment specification in Lydia syntax
+			* \param partition Partitioning of problem variables
+			* \param starting_player Player who moves first each turn
+			* \param solver Engine used to solve the game
+			* 
+			*/
+			ComponentAdversarialSynthesizer(std::shared_ptr<VarMgr> var_mgr,
+									std::string agent_specification,
+									std::string environment_specification,
+									InputOutputPartition partition,
+									Player starting_player,
+									ComponentGameSolver solver = ComponentGameSolver::OnTheFly);
+			
+			/**
+			 * @brief Solves the game of E -> Phi over A_phi x A_E x A_tt without building the product
+			 * 
+			 * @return SynthesisResult storing realizability and the agent winning states found. No transducer is computed.
+			 */
+			virtual SynthesisResult run() final;
+
+			/**
+			 * @brief Returns running times of major operations during synthesis
+			 * 
+			 * @return std::vector<double> storing running times  
+			 */
+			std::vector<double> get_running_times() const;
+	};
+}
+#endif
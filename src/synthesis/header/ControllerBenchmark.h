@@ -0,0 +1,57 @@
+#ifndef CONTROLLER_BENCHMARK_H
+#define CONTROLLER_BENCHMARK_H
+
+#include <cstdint>
+#include <vector>
+
+#include "Transducer.h"
+
+namespace Syft {
+
+/**
+ * \brief Running times of the ways of executing a transducer on the same traces.
+ */
+struct ControllerBenchmarkResult {
+  std::size_t step_count;
+  double eval_time;
+  double executor_time;
+  double bit_sliced_time;
+  // True iff all three produced the same outputs
+  bool outputs_agree;
+};
+
+/**
+ * \brief Compares CUDD::BDD::Eval, TransducerExecutor and BitSlicedController on random traces.
+ */
+class ControllerBenchmark {
+ private:
+
+  const Transducer& transducer_;
+
+  std::vector<std::vector<std::uint8_t>> run_eval(
+      const std::vector<std::vector<std::uint8_t>>& traces) const;
+
+ public:
+
+  /**
+   * \brief Constructs a benchmark for the given transducer, which must outlive it.
+   */
+  explicit ControllerBenchmark(const Transducer& transducer);
+
+  /**
+   * \brief Generates uniformly random input traces and runs them in all three ways.
+   *
+   * \param trace_count The number of traces.
+   * \param trace_length The number of steps of each trace.
+   * \param seed The seed of the random generator.
+   * \return The time in seconds each way took, excluding the construction
+   *   of the executor and the controller.
+   */
+  ControllerBenchmarkResult run(std::size_t trace_count,
+                                std::size_t trace_length,
+                                unsigned int seed = 0) const;
+};
+
+}
+
+#endif // CONTROLLER_BENCHMARK_H
@@ -2,6 +2,7 @@
 #define DFA_GAME_SYNTHESIZER_H
 
 #include "Quantification.h"
+#include "StrategyExtractor.h"
 #include "SymbolicStateDfa.h"
 #include "Synthesizer.h"
 #include "Transducer.h"
@@ -21,13 +22,17 @@ class DfaGameSynthesizer : public Synthesizer<SymbolicStateDfa> {
   std::vector<CUDD::BDD> transition_vector_;
   std::unique_ptr<Quantification> quantify_independent_variables_;
   std::unique_ptr<Quantification> quantify_non_state_variables_;
+  StrategyExtractionOptions extraction_options_;
 
   CUDD::BDD preimage(const CUDD::BDD& winning_states) const;
 
   CUDD::BDD project_into_states(const CUDD::BDD& winning_moves) const;
   
-  std::unordered_map<int, CUDD::BDD> synthesize_strategy(
-      const CUDD::BDD& winning_moves) const;
+  /**
+   * \brief Stores a strategy for the winning moves in \a result, with StrategyExtractor::attach_strategy.
+   */
+  void attach_strategy(SynthesisResult& result,
+                       const CUDD::BDD& winning_moves) const;
   
   bool includes_initial_state(const CUDD::BDD& winning_states) const;
   
@@ -40,8 +45,22 @@ class DfaGameSynthesizer : public Synthesizer<SymbolicStateDfa> {
    *
    * \param spec A symbolic-state DFA representing the game's arena.
    * \param starting_player The player that moves first each turn.
+   * \param extraction_options Options for extracting the output functions.
+   */
+  DfaGameSynthesizer(SymbolicStateDfa spec, Player starting_player, Player protagonist_player,
+                     StrategyExtractionOptions extraction_options = StrategyExtractionOptions());
+
+  /**
+   * \brief Construct a synthesizer for a given DFA game, reusing the compose vector of its transition function.
+   *
+   * For solving several games on the same arena.
+   *
+   * \param transition_vector The result of VarMgr::make_compose_vector for
+   *   the automaton ID and transition function of \a spec.
    */
-  DfaGameSynthesizer(SymbolicStateDfa spec, Player starting_player, Player protagonist_player);
+  DfaGameSynthesizer(SymbolicStateDfa spec, Player starting_player, Player protagonist_player,
+                     std::vector<CUDD::BDD> transition_vector,
+                     StrategyExtractionOptions extraction_options = StrategyExtractionOptions());
 
 
   /**
@@ -0,0 +1,81 @@
+/*
+* This header declares the class ExplicitAdversarialSynthesizer
+* which implements reactive synthesis under environment assumptions
+* by solving the reachability game over the explicit states of the DFA
+*/
+
+#ifndef SYFT_EXPLICITADVERSARIALSYNTHESIZER_H
+#define SYFT_EXPLICITADVERSARIALSYNTHESIZER_H
+
+#include"ExplicitStateDfaMona.h"
+#include"ExplicitStateDfa.h"
+#include"BitParallelReachabilitySynthesizer.h"
+#include"HybridReachabilitySynthesizer.h"
+#include"InputOutputPartition.h"
+#include"Stopwatch.h"
+#include"spotparser.h"
+
+namespace Syft {
+
+	/**
+	 * \brief Engine used to solve the explicit-state game.
+	 *
+	 * Hybrid keeps letters symbolic, BitParallel expands them into dense
+	 * predecessor tables, evaluates 64 states per word operation and only
+	 * applies to small alphabets.
+	 */
+	enum class ExplicitGameSolver {Hybrid, BitParallel};
+
+	class ExplicitAdversarialSynthesizer {
+	
+		protected:
+			std::shared_ptr<Syft::VarMgr> var_mgr_;
+
+			std::string agent_specification_;
+			std::string environment_specification_;
+
+			Player starting_player_;
+
+			ExplicitGameSolver solver_;
+
+			std::vector<ExplicitStateDfa> explicit_dfa_;
+
+			InputOutputPartition partition_;
+
+			std::vector<double> running_times_;
+		public:
+		
+			/**
+			* \brief Construct an object presenting the reactive synthesis problem (E, Phi)
+			* 
+			* \param var_mgr Dictionary storing variables of the problem
+			* \param agent_specification LTLf agent goal in Lydia syntax
+			* \param environment_assumption LTLf environment specification in Lydia syntax
+			* \param partition Partitioning of problem variables
+			* \param starting_player Player who moves first each turn
+			* \param solver Engine used to solve the explicit-state game
+			* 
+			*/
+			ExplicitAdversarialSynthesizer(std::shared_ptr<VarMgr> var_mgr,
+									std::string agent_specification,
+									std::string environment_specification,
+									InputOutputPartition partition,
+									Player starting_player,
+									ExplicitGameSolver solver = ExplicitGameSolver::Hybrid);
+			
+			/**
+			 * @brief Solves the explicit-state DFA game of E -> Phi
+			 * 
+			 * @return SynthesisResult storing realizability and the agent winning region. No transducer is computed.
+			 */
+			virtual SynthesisResult run() final;
+
+			/**
+			 * @brief Returns running times of major operations during synthesis
+			 * 
+			 * @return std::vector<double> storing running times  
+			 */
+			std::vector<double> get_running_times() const;
+	};
+}
+#endif
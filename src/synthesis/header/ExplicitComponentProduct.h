@@ -0,0 +1,158 @@
+#ifndef EXPLICIT_COMPONENT_PRODUCT_H
+#define EXPLICIT_COMPONENT_PRODUCT_H
+
+#include <boost/functional/hash.hpp>
+
+#include "ExplicitStateDfa.h"
+#include "LetterClasses.h"
+#include "Player.h"
+
+namespace Syft {
+
+/**
+ * \brief The product A_phi x A_E x A_tt of explicit-state component DFAs.
+ *
+ * Product states are tuples of component states and are never enumerated:
+ * successors are computed component by component from tables indexed by
+ * letter class, so solvers only pay for the product states they visit.
+ *
+ * Letters are split as in BitParallelReachabilitySynthesizer: the player
+ * moving first picks an outer class, the other player an inner class.
+ */
+class ExplicitComponentProduct {
+ public:
+
+  using ProductState = std::vector<std::size_t>;
+  using ProductStateHash = boost::hash<ProductState>;
+
+  static constexpr std::size_t agent_component = 0;
+  static constexpr std::size_t environment_component = 1;
+  static constexpr std::size_t tautology_component = 2;
+
+ private:
+
+  std::shared_ptr<VarMgr> var_mgr_;
+  std::vector<ExplicitStateDfa> components_;
+  std::vector<std::vector<bool>> final_states_;
+
+  std::size_t outer_letter_count_;
+  std::size_t inner_letter_count_;
+  bool outer_exists_;
+
+  // successor_tables_[c][q * letter_count + outer * inner_letter_count_ + inner]
+  std::vector<std::vector<std::size_t>> successor_tables_;
+  // predecessor_tables_[c][(outer * inner_letter_count_ + inner) * state_count + q]
+  // lists the states of component c moving to q on that letter class
+  std::vector<std::vector<std::vector<std::size_t>>> predecessor_tables_;
+
+  // State variables encoding each component in product_states_to_bdd
+  std::vector<std::size_t> encoding_automaton_ids_;
+
+ public:
+
+  /**
+   * \brief Builds the per-component successor and predecessor tables.
+   *
+   * Also creates the state variables used by product_states_to_bdd.
+   *
+   * \param var_mgr The variable manager of the components.
+   * \param agent_dfa The DFA A_phi of the agent goal.
+   * \param environment_dfa The DFA A_E of the environment specification.
+   * \param tautology_dfa The DFA A_tt accepting all non-empty traces.
+   * \param starting_player The player that moves first each turn.
+   */
+  ExplicitComponentProduct(std::shared_ptr<VarMgr> var_mgr,
+                           const ExplicitStateDfa& agent_dfa,
+                           const ExplicitStateDfa& environment_dfa,
+                           const ExplicitStateDfa& tautology_dfa,
+                           Player starting_player);
+
+  /**
+   * \brief Returns the number of component DFAs.
+   */
+  std::size_t component_count() const;
+
+  /**
+   * \brief Returns the c-th component DFA.
+   */
+  const ExplicitStateDfa& component(std::size_t c) const;
+
+  /**
+   * \brief Returns the number of states of the full product.
+   */
+  double product_state_count() const;
+
+  /**
+   * \brief Returns the tuple of the initial states of the components.
+   */
+  ProductState initial_state() const;
+
+  /**
+   * \brief Returns true iff \a state is a final state of component \a c.
+   */
+  bool is_final(std::size_t c, std::size_t state) const;
+
+  /**
+   * \brief Returns true iff \a state satisfies f_tt /\ (!f_E \/ f_phi).
+   */
+  bool is_goal(const ProductState& state) const;
+
+  /**
+   * \brief Returns the number of classes the player moving first picks from.
+   */
+  std::size_t outer_letter_count() const;
+
+  /**
+   * \brief Returns the number of classes the player moving second picks from.
+   */
+  std::size_t inner_letter_count() const;
+
+  /**
+   * \brief Returns true iff the agent is the player moving first.
+   */
+  bool outer_exists() const;
+
+  /**
+   * \brief Returns the successor of a component state on a letter class.
+   */
+  std::size_t successor(std::size_t c,
+                        std::size_t state,
+                        std::size_t outer,
+                        std::size_t inner) const;
+
+  /**
+   * \brief Returns the successor of a product state on a letter class.
+   */
+  ProductState successor(const ProductState& state,
+                         std::size_t outer,
+                         std::size_t inner) const;
+
+  /**
+   * \brief Returns the states of a component moving to \a state on a letter class.
+   */
+  const std::vector<std::size_t>& predecessors(std::size_t c,
+                                               std::size_t state,
+                                               std::size_t outer,
+                                               std::size_t inner) const;
+
+  /**
+   * \brief Encodes a set of product states as a BDD.
+   *
+   * Each component is encoded over its own state variables, created with the
+   * product, so the BDD is over the same kind of encoding as
+   * SymbolicStateDfa::product and encoding again adds no variables.
+   */
+  CUDD::BDD product_states_to_bdd(const std::vector<ProductState>& states) const;
+
+  /**
+   * \brief Encodes the product of one set of states per component as a BDD.
+   *
+   * Uses the same encoding as product_states_to_bdd.
+   */
+  CUDD::BDD component_sets_to_bdd(
+      const std::vector<std::vector<std::size_t>>& state_sets) const;
+};
+
+}
+
+#endif // EXPLICIT_COMPONENT_PRODUCT_H
@@ -6,6 +6,7 @@
 #ifndef SYFT_EXPLICITCOMPOSITIONALBESTEFFORTSYNTHESIZER_H
 #define SYFT_EXPLICITCOMPOSITIONALBESTEFFORTSYNTHESIZER_H
 
+#include"AnytimeOptions.h"
 #include"ExplicitStateDfaMona.h"
 #include"ExplicitStateDfa.h"
 #include"SymbolicStateDfa.h"
@@ -27,12 +28,16 @@ namespace Syft {
 
 			Player starting_player_;
 
+			StrategyExtractionOptions extraction_options_;
+
 			std::vector<SymbolicStateDfa> symbolic_dfas_;
 			std::vector<SymbolicStateDfa> arena_;
 
 			InputOutputPartition partition_;
 
 			std::vector<double> running_times_;
+
+			AnytimeOptions anytime_options_;
 		public:
 		
 			/**
@@ -43,13 +48,15 @@ namespace Syft {
 			* \param environment_assumption LTLf environment specification in Lydia syntax
 			* \param partition Partitioning of problem variables
 			* \param starting_player Player who moves first each turn
+			* \param extraction_options Options for extracting output functions
 			* 
 			*/
             ExplicitCompositionalBestEffortSynthesizer(std::shared_ptr<VarMgr> var_mgr,
 									std::string agent_specification,
 									std::string environment_specification,
 									InputOutputPartition partition,
-									Player starting_player);
+									Player starting_player,
+									StrategyExtractionOptions extraction_options = StrategyExtractionOptions());
 			
 			/**
 			 * @brief Solves symbolic DFA games to compute adversarially and cooperatively winning strategies
@@ -58,17 +65,13 @@ namespace Syft {
 			 */
 			virtual std::pair<SynthesisResult, SynthesisResult> run() final;
 
-			/**
-			* \brief Merges two transducers into a best-effort strategy
-			*
-			* \param adversarial_result Reactive synthesis result
-			* \param coopeartive_result Cooperative synthesis result
-			* \param filename A path to the output .dot file
-			* \return void. Prints implementation function of best-effort strategy into a .dot file
-			*/
-			void merge_and_dump_dot(const SynthesisResult& adversarial_result, 
-									const SynthesisResult& cooperative_result, 
-									const string& filename) const;
+
+		/**
+		 * @brief Sets how the games are reported as soon as they are solved, and whether the cooperative game may be skipped
+		 *
+		 * @param anytime_options Options applying to the next calls of run()
+		 */
+		void set_anytime_options(AnytimeOptions anytime_options);
 
 		/**
 		 * @brief Returns running times of major operations during synthesis
@@ -0,0 +1,82 @@
+#ifndef HYBRID_REACHABILITY_SYNTHESIZER_H
+#define HYBRID_REACHABILITY_SYNTHESIZER_H
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "ExplicitStateDfa.h"
+#include "LetterClasses.h"
+#include "Player.h"
+#include "Quantification.h"
+#include "Synthesizer.h"
+
+namespace Syft {
+
+/**
+ * \brief A synthesizer for a reachability game whose arena is an explicit-state DFA.
+ *
+ * States are kept explicit and sets of states are represented as bitsets.
+ * Letters are kept symbolic: the alphabet is split into the letter classes of
+ * the DFA, and the letters that move a state into the winning region are the
+ * union of the classes whose successor is winning. No logarithmic state
+ * encoding and no CUDD::BDD::VectorCompose are needed to solve the game.
+ */
+class HybridReachabilitySynthesizer : public Synthesizer<ExplicitStateDfa> {
+ private:
+
+  std::shared_ptr<VarMgr> var_mgr_;
+  Player starting_player_;
+  Player protagonist_player_;
+  std::vector<std::size_t> goal_states_;
+  // State variables encoding the winning region returned by run
+  std::size_t winning_state_automaton_id_;
+  std::vector<CUDD::BDD> letter_classes_;
+  std::vector<std::vector<std::size_t>> class_successors_;
+  std::vector<std::vector<std::size_t>> predecessors_;
+  std::unique_ptr<Quantification> quantify_independent_variables_;
+  std::unique_ptr<Quantification> quantify_non_state_variables_;
+
+  /**
+   * \brief Returns the letters that move \a state into \a winning_states.
+   */
+  CUDD::BDD winning_letters(std::size_t state,
+                            const boost::dynamic_bitset<>& winning_states) const;
+
+ public:
+
+  /**
+   * \brief Construct a synthesizer for the given reachability game.
+   *
+   * \param spec An explicit-state DFA representing the game's arena.
+   * \param starting_player The player that moves first each turn.
+   * \param protagonist_player The player that must reach the goal.
+   * \param goal_states The set of states that the protagonist must reach.
+   */
+  HybridReachabilitySynthesizer(ExplicitStateDfa spec,
+                                Player starting_player,
+                                Player protagonist_player,
+                                std::vector<std::size_t> goal_states);
+
+  /**
+   * \brief Computes the set of winning states of the game as a bitset.
+   *
+   * \param stop_at_initial If true, stops as soon as the initial state is
+   *   found to be winning.
+   * \return A bitset whose \a i-th bit is set iff state \a i is winning.
+   */
+  boost::dynamic_bitset<> winning_region(bool stop_at_initial = false) const;
+
+  /**
+   * \brief Solves the reachability game.
+   *
+   * \return The result consists of
+   * realizability
+   * a set of agent winning states, encoded over state variables created
+   * once per synthesizer
+   * nullptr in place of the transducer, since no strategy is extracted.
+   */
+  virtual SynthesisResult run() const final;
+};
+
+}
+
+#endif // HYBRID_REACHABILITY_SYNTHESIZER_H
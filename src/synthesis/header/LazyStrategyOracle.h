@@ -0,0 +1,112 @@
+#ifndef LAZY_STRATEGY_ORACLE_H
+#define LAZY_STRATEGY_ORACLE_H
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+#include <cuddObj.hh>
+
+#include "Player.h"
+#include "VarMgr.h"
+
+namespace Syft {
+
+/**
+ * \brief Answers strategy queries on demand from the winning moves of a game.
+ *
+ * No output function is computed up front. Given a state and an input, the
+ * oracle walks the BDD of the winning moves with the state and input
+ * variables fixed until it finds a path to 1, and reads the protagonist's
+ * variables off that path. Recent answers are kept in an LRU cache.
+ *
+ * States hold one byte per state variable of the automaton, inputs one byte
+ * per variable of the player the protagonist plays against, and outputs one
+ * byte per variable of the protagonist, all in label order.
+ */
+class LazyStrategyOracle {
+ private:
+
+  using Key = std::vector<std::uint8_t>;
+
+  struct CacheEntry {
+    Key key;
+    bool found;
+    std::vector<std::uint8_t> output;
+  };
+
+  std::shared_ptr<VarMgr> var_mgr_;
+  CUDD::BDD winning_moves_;
+  std::vector<int> initial_state_;
+  std::vector<int> state_indices_;
+  std::vector<int> input_indices_;
+  std::vector<int> output_indices_;
+  std::size_t cache_capacity_;
+
+  // Most recently used entries first
+  mutable std::list<CacheEntry> cache_;
+  mutable std::unordered_map<Key, std::list<CacheEntry>::iterator,
+                             boost::hash<Key>> cache_index_;
+  mutable std::size_t hits_ = 0;
+  mutable std::size_t misses_ = 0;
+
+  // -1 for the protagonist's variables, which are free during a search
+  mutable std::vector<int> valuation_;
+  // Values of the free variables on the path found by the last search
+  mutable std::vector<std::uint8_t> chosen_;
+
+  bool search(DdNode* node, std::unordered_set<DdNode*>& failed) const;
+
+ public:
+
+  /**
+   * \brief Constructs an oracle for the given winning moves.
+   *
+   * \param var_mgr The variable manager of the game.
+   * \param automaton_id The ID of the automaton whose state variables the
+   *   states refer to.
+   * \param winning_moves A BDD over state, input and output variables that
+   *   holds for the moves that keep the protagonist in its winning region.
+   * \param initial_state The initial state of the game.
+   * \param protagonist_player The player whose variables the oracle outputs.
+   * \param cache_capacity The number of answers kept in the cache.
+   */
+  LazyStrategyOracle(std::shared_ptr<VarMgr> var_mgr,
+                     std::size_t automaton_id,
+                     CUDD::BDD winning_moves,
+                     std::vector<int> initial_state,
+                     Player protagonist_player,
+                     std::size_t cache_capacity = 4096);
+
+  /**
+   * \brief Computes a winning move for the given state and input.
+   *
+   * \param state The current state.
+   * \param input The current input.
+   * \param output Receives the move. Variables the move does not constrain are 0.
+   * \return False iff there is no winning move from \a state on \a input.
+   */
+  bool query(const std::vector<std::uint8_t>& state,
+             const std::vector<std::uint8_t>& input,
+             std::vector<std::uint8_t>& output) const;
+
+  /**
+   * \brief Returns the initial state of the game.
+   */
+  std::vector<std::uint8_t> initial_state() const;
+
+  std::size_t input_count() const;
+
+  std::size_t output_count() const;
+
+  std::size_t cache_hits() const;
+
+  std::size_t cache_misses() const;
+};
+
+}
+
+#endif // LAZY_STRATEGY_ORACLE_H
@@ -0,0 +1,159 @@
+#ifndef LETTER_CLASSES_H
+#define LETTER_CLASSES_H
+
+#include <map>
+#include <utility>
+
+#include "ExplicitStateDfa.h"
+#include "Player.h"
+
+namespace Syft {
+
+/**
+ * \brief A partition of the valuations of a set of variables into classes.
+ */
+struct LetterPartition {
+  /**
+   * \brief Indices of the variables valuated by the partition, in CUDD order.
+   */
+  std::vector<int> variable_indices;
+
+  /**
+   * \brief The classes of the partition, as BDDs over \a variable_indices.
+   */
+  std::vector<CUDD::BDD> classes;
+
+  /**
+   * \brief A representative valuation of each class.
+   *
+   * Representatives have one position for each BDD variable, as the input of
+   * CUDD::BDD::Eval. Positions of variables outside \a variable_indices are 0,
+   * so that representatives of partitions over disjoint variables can be
+   * combined by adding them.
+   */
+  std::vector<std::vector<int>> representatives;
+
+  /**
+   * \brief Returns the number of classes.
+   */
+  std::size_t class_count() const;
+
+  /**
+   * \brief Returns the class containing a valuation.
+   *
+   * \param valuation A vector with one position for each BDD variable.
+   */
+  std::size_t class_of(const std::vector<int>& valuation) const;
+};
+
+/**
+ * \brief The coarsest partitions of the alphabet consistent with a set of DFAs.
+ *
+ * Two letters are in the same class if every transition of every DFA leads
+ * to the same successor on both. Solvers that work over one representative
+ * per class then depend on the number of distinct behaviours rather than on
+ * the number of propositions.
+ *
+ * Besides the partition of the whole alphabet, the input and the output
+ * valuations are partitioned separately: two input valuations are equivalent
+ * if they lead to the same successors whatever the output, and vice versa.
+ * Quantifying over the representatives of these partitions is exact, so games
+ * can be solved on the product of the two.
+ *
+ * The classes can also be computed for arbitrary functions, such as the
+ * output and next-state functions of a transducer.
+ */
+class LetterClasses {
+ private:
+
+  struct Refinement {
+    std::vector<CUDD::ADD> functions;
+    std::vector<std::pair<std::size_t, CUDD::BDD>> classes;
+  };
+
+  using Signature = std::vector<DdNode*>;
+
+  std::shared_ptr<VarMgr> var_mgr_;
+  // The functions the classes are consistent with
+  std::vector<CUDD::ADD> functions_;
+
+  LetterPartition joint_partition_;
+  LetterPartition input_partition_;
+  LetterPartition output_partition_;
+
+  static Signature signature_of(const std::vector<CUDD::ADD>& functions);
+
+  const std::vector<std::pair<std::size_t, CUDD::BDD>>& refine(
+      const std::vector<CUDD::ADD>& functions,
+      std::size_t position,
+      const std::vector<int>& variable_indices,
+      std::map<std::pair<std::size_t, Signature>, Refinement>& refinement_table,
+      std::map<Signature, std::size_t>& class_ids) const;
+
+  LetterPartition partition(const std::vector<std::string>& variable_names) const;
+
+  void compute_partitions();
+
+ public:
+
+  /**
+   * \brief Computes the letter classes of a set of DFAs.
+   *
+   * \param var_mgr The variable manager of the DFAs, whose variables must
+   *   already be partitioned between inputs and outputs.
+   * \param dfas The DFAs whose transitions the classes must be consistent with.
+   */
+  LetterClasses(std::shared_ptr<VarMgr> var_mgr,
+                const std::vector<ExplicitStateDfa>& dfas);
+
+  /**
+   * \brief Computes the letter classes of a set of functions.
+   *
+   * Two letters are in the same class if every function has the same
+   * cofactor on both.
+   *
+   * \param var_mgr The variable manager of the functions, whose variables must
+   *   already be partitioned between inputs and outputs.
+   * \param functions The functions the classes must be consistent with.
+   */
+  LetterClasses(std::shared_ptr<VarMgr> var_mgr,
+                std::vector<CUDD::ADD> functions);
+
+  /**
+   * \brief Returns the partition of the valuations of all input and output variables.
+   */
+  const LetterPartition& joint_partition() const;
+
+  /**
+   * \brief Returns the partition of the valuations of the input variables.
+   */
+  const LetterPartition& input_partition() const;
+
+  /**
+   * \brief Returns the partition of the valuations of the output variables.
+   */
+  const LetterPartition& output_partition() const;
+
+  /**
+   * \brief Returns the partition of the variables of the player moving first.
+   */
+  const LetterPartition& first_mover_partition(Player starting_player) const;
+
+  /**
+   * \brief Returns the partition of the variables of the player moving second.
+   */
+  const LetterPartition& second_mover_partition(Player starting_player) const;
+
+  /**
+   * \brief Returns the successor of an ADD transition function on a letter.
+   *
+   * \param transition_function The transition ADD of a state.
+   * \param valuation A vector with one position for each BDD variable.
+   */
+  static std::size_t successor(const CUDD::ADD& transition_function,
+                               const std::vector<int>& valuation);
+};
+
+}
+
+#endif // LETTER_CLASSES_H
@@ -0,0 +1,101 @@
+#ifndef MEALY_MACHINE_H
+#define MEALY_MACHINE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Transducer.h"
+
+namespace Syft {
+
+/**
+ * \brief An explicit Mealy machine running a strategy with one table lookup per step.
+ *
+ * Input letters are the classes of input valuations that the strategy does
+ * not tell apart: in every state, all valuations of a class give the same
+ * output and the same successor, so the table has one column per class rather
+ * than one per valuation. letter_of maps an input word, a 64-bit word where
+ * bit i is the value of the i-th input label, to its letter. Output letters
+ * are 64-bit words where bit i is the value of the i-th output label. State 0
+ * is the initial state.
+ */
+class MealyMachine {
+ private:
+
+  /**
+   * \brief A node of the decision diagram mapping input words to letters.
+   *
+   * Leaves have bit -1 and hold their letter in then_node.
+   */
+  struct LetterNode {
+    std::int32_t bit;
+    std::uint32_t then_node;
+    std::uint32_t else_node;
+  };
+
+  std::vector<std::string> input_labels_;
+  std::vector<std::string> output_labels_;
+  std::size_t letter_count_;
+  // Rooted at position 0
+  std::vector<LetterNode> letter_nodes_;
+  // An input word of each letter
+  std::vector<std::uint64_t> representatives_;
+  // Indexed by state * letter_count_ + letter
+  std::vector<std::uint32_t> next_state_;
+  std::vector<std::uint64_t> output_;
+
+  MealyMachine(std::vector<std::string> input_labels,
+               std::vector<std::string> output_labels);
+
+ public:
+
+  /**
+   * \brief Explores the states reachable from the initial state when the transducer runs in closed loop.
+   *
+   * The input letters are the LetterClasses of the output functions and of
+   * the next-state functions, with the outputs substituted. A representative
+   * of every letter is tried in every state, so the number of letters must
+   * not exceed \a max_letter_count. The transducer may have at most 64 inputs
+   * and 64 outputs.
+   */
+  static MealyMachine from_transducer(const Transducer& transducer,
+                                      std::size_t max_letter_count = std::size_t(1) << 20);
+
+  /**
+   * \brief Returns the minimal equivalent machine.
+   *
+   * States are merged by partition refinement: the initial partition groups
+   * states with the same outputs on every letter, and blocks are split until
+   * all states in a block move to the same blocks.
+   */
+  MealyMachine minimize() const;
+
+  /**
+   * \brief Returns the next state and stores the output letter in \a output.
+   */
+  std::uint32_t step(std::uint32_t state, std::size_t letter,
+                     std::uint64_t& output) const;
+
+  /**
+   * \brief Returns the letter of an input word.
+   */
+  std::size_t letter_of(std::uint64_t input) const;
+
+  std::size_t state_count() const;
+
+  std::size_t letter_count() const;
+
+  /**
+   * \brief Saves the machine as a C header with a single transition table.
+   *
+   * Entry [s][l] of the table holds the next state and the output letter for
+   * state s and input letter l. The header also defines besyft_letter, which
+   * maps an input word to its letter like letter_of.
+   */
+  void dump_table(const std::string& filename) const;
+};
+
+}
+
+#endif // MEALY_MACHINE_H
@@ -0,0 +1,61 @@
+#ifndef ON_THE_FLY_REACHABILITY_SYNTHESIZER_H
+#define ON_THE_FLY_REACHABILITY_SYNTHESIZER_H
+
+#include "ExplicitComponentProduct.h"
+#include "Synthesizer.h"
+
+namespace Syft {
+
+/**
+ * \brief A synthesizer that solves the adversarial game over A_phi x A_E x A_tt
+ * without building the product.
+ *
+ * The game is seen as an AND-OR graph: product states and the choices of the
+ * player moving first are the nodes, and the choices of the two players are
+ * the branches. The graph is explored forward from the initial state, and
+ * every time a state is found to be winning the information is propagated
+ * backward through counters of its pending predecessors. The search stops as
+ * soon as the initial state is decided, and states whose predecessors are
+ * already decided are not expanded.
+ */
+class OnTheFlyReachabilitySynthesizer : public Synthesizer<ExplicitComponentProduct> {
+ private:
+
+  mutable std::size_t discovered_state_count_ = 0;
+  mutable std::size_t expanded_state_count_ = 0;
+
+ public:
+
+  /**
+   * \brief Construct a synthesizer for the agent in the given product game.
+   *
+   * \param spec The product of the component DFAs. The agent must reach a
+   *   state satisfying ExplicitComponentProduct::is_goal.
+   */
+  OnTheFlyReachabilitySynthesizer(ExplicitComponentProduct spec);
+
+  /**
+   * \brief Solves the game from the initial state.
+   *
+   * \return The result consists of
+   * realizability
+   * the agent winning states found by the search, encoded over fresh state
+   * variables for each component
+   * nullptr in place of the transducer, since no strategy is extracted.
+   */
+  virtual SynthesisResult run() const final;
+
+  /**
+   * \brief Returns the number of product states stored by the last call to run.
+   */
+  std::size_t discovered_state_count() const;
+
+  /**
+   * \brief Returns the number of product states expanded by the last call to run.
+   */
+  std::size_t expanded_state_count() const;
+};
+
+}
+
+#endif // ON_THE_FLY_REACHABILITY_SYNTHESIZER_H
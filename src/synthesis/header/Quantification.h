@@ -1,8 +1,12 @@
 #ifndef QUANTIFICATION_H
 #define QUANTIFICATION_H
 
+#include <memory>
+
 #include <cuddObj.hh>
 
+#include "Player.h"
+
 namespace Syft {
 
 /**
@@ -96,7 +100,31 @@ class ExistsExists final: public Quantification {
         CUDD::BDD apply(const CUDD::BDD& bdd) const override;
     };
 
+/**
+ * \brief The quantifier prefixes of a reachability game.
+ *
+ * independent_variables quantifies all variables that the outputs don't
+ * depend on (input variables if the agent plays first, or no variables if the
+ * environment plays first). non_state_variables quantifies all remaining
+ * variables that are not state variables.
+ */
+struct GameQuantifiers {
+  std::unique_ptr<Quantification> independent_variables;
+  std::unique_ptr<Quantification> non_state_variables;
+};
 
+/**
+ * \brief Returns the quantifier prefixes of a game in which \a protagonist_player must reach the goal.
+ *
+ * \param input_cube The cube of the input variables.
+ * \param output_cube The cube of the output variables.
+ * \param starting_player The player that moves first each turn.
+ * \param protagonist_player The player that must reach the goal.
+ */
+GameQuantifiers game_quantifiers(const CUDD::BDD& input_cube,
+                                 const CUDD::BDD& output_cube,
+                                 Player starting_player,
+                                 Player protagonist_player);
 
 }
 
@@ -22,9 +22,22 @@ class ReachabilitySynthesizer : public DfaGameSynthesizer {
    * \param spec A symbolic-state DFA representing the reachability game.
    * \param starting_player The player that moves first each turn.
    * \param goal_states The set of states that the agent must reach to win.
+   * \param extraction_options Options for extracting the output functions.
    */
   ReachabilitySynthesizer(SymbolicStateDfa spec, Player starting_player, Player protagonist_player,
-			  CUDD::BDD goal_states, CUDD::BDD state_space);
+			  CUDD::BDD goal_states, CUDD::BDD state_space,
+			  StrategyExtractionOptions extraction_options = StrategyExtractionOptions());
+
+  /**
+   * \brief Construct a synthesizer for the given reachability game, reusing the compose vector of its transition function.
+   *
+   * \param transition_vector The result of VarMgr::make_compose_vector for
+   *   the automaton ID and transition function of \a spec.
+   */
+  ReachabilitySynthesizer(SymbolicStateDfa spec, Player starting_player, Player protagonist_player,
+			  CUDD::BDD goal_states, CUDD::BDD state_space,
+			  std::vector<CUDD::BDD> transition_vector,
+			  StrategyExtractionOptions extraction_options = StrategyExtractionOptions());
 
     /**
      * \brief Solves the reachability game.
@@ -0,0 +1,116 @@
+#ifndef RESULT_STORE_H
+#define RESULT_STORE_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "InputOutputPartition.h"
+#include "Player.h"
+
+namespace Syft {
+
+/**
+ * \brief A verdict and its running times, as saved in a ResultStore.
+ */
+struct StoredResult {
+  std::string algorithm;
+  std::vector<double> run_times;
+  std::string verdict;
+};
+
+/**
+ * \brief Persistent cache of synthesis results.
+ *
+ * Results are appended to a data file, one record per line, together with the
+ * canonical key of the problem they solve. A second file, named after the data
+ * file with a .idx suffix, holds one fixed-size (hash, offset) entry per record.
+ * It is memory-mapped when the store is opened, to fill a hash table from key
+ * hashes to record offsets, so that a lookup only reads the records whose key
+ * has the same hash. Both files are append-only, so a later record for the
+ * same key shadows the earlier ones. The index is rebuilt from the data file
+ * if it is missing or truncated.
+ *
+ * The store assumes a single writing process.
+ */
+class ResultStore {
+ private:
+
+  struct IndexEntry {
+    std::uint64_t hash;
+    std::uint64_t offset;
+  };
+
+  std::string data_file_;
+  std::string index_file_;
+  int index_fd_;
+  const IndexEntry* entries_;
+  std::size_t entry_count_;
+  // Offsets of the records by key hash, oldest first
+  std::unordered_map<std::uint64_t, std::vector<std::uint64_t>> offsets_;
+  std::size_t record_count_;
+
+  static std::uint64_t hash(const std::string& key);
+
+  void map_index();
+
+  void unmap_index();
+
+  void rebuild_index();
+
+ public:
+
+  /**
+   * \brief Opens the store saved in \a data_file, creating it if needed.
+   */
+  explicit ResultStore(const std::string& data_file);
+
+  ResultStore(const ResultStore&) = delete;
+  ResultStore& operator=(const ResultStore&) = delete;
+
+  ~ResultStore();
+
+  /**
+   * \brief Returns the canonical key of a synthesis problem.
+   *
+   * Runs of whitespace in the formulas count as a single space, and leading
+   * and trailing whitespace is ignored, so that "F a" and the atom "Fa" keep
+   * distinct keys. The order of the variables within each side of the
+   * partition is ignored.
+   *
+   * \param agent_specification LTLf agent goal in Lydia syntax.
+   * \param environment_assumption LTLf environment specification in Lydia syntax.
+   * \param partition Partitioning of problem variables.
+   * \param starting_player Player who moves first each turn.
+   * \param algorithm The algorithm, as passed to -t.
+   * \param version The version of the binary that computes the result.
+   */
+  static std::string make_key(const std::string& agent_specification,
+                              const std::string& environment_assumption,
+                              const InputOutputPartition& partition,
+                              Player starting_player,
+                              int algorithm,
+                              const std::string& version);
+
+  /**
+   * \brief Looks up the latest result saved for \a key.
+   *
+   * \return Whether a result was found.
+   */
+  bool lookup(const std::string& key, StoredResult& result) const;
+
+  /**
+   * \brief Appends a result for \a key.
+   */
+  void insert(const std::string& key, const StoredResult& result);
+
+  /**
+   * \brief Returns the number of records, including shadowed ones.
+   */
+  std::size_t size() const;
+};
+
+}
+
+#endif // RESULT_STORE_H
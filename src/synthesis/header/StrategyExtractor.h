@@ -0,0 +1,176 @@
+#ifndef STRATEGY_EXTRACTOR_H
+#define STRATEGY_EXTRACTOR_H
+
+#include <set>
+#include <unordered_map>
+
+#include "Player.h"
+#include "SymbolicStateDfa.h"
+#include "Synthesizer.h"
+#include "Transducer.h"
+#include "VarMgr.h"
+
+namespace Syft {
+
+/**
+ * \brief Algorithm used to compute the output functions.
+ *
+ * SolveEqn computes all output functions at once with CUDD::BDD::SolveEqn.
+ * Skolem computes them one at a time, quantifying the outputs out one by one
+ * in an order chosen from the interactions between outputs.
+ */
+enum class StrategyExtractionMode {SolveEqn, Skolem};
+
+/**
+ * \brief Options controlling how output functions are extracted from the winning moves of a game.
+ */
+struct StrategyExtractionOptions {
+  /**
+   * \brief Check that the output functions always pick a winning move when there is one.
+   *
+   * The SolveEqn mode uses CUDD::BDD::VerifySol, the Skolem mode composes the
+   * output functions back into the winning moves.
+   *
+   * Verification costs as much as the extraction itself, so it is off by default.
+   */
+  bool verify = false;
+
+  /**
+   * \brief Print the time spent on each output variable.
+   */
+  bool report_times = false;
+
+  /**
+   * \brief Algorithm used to compute the output functions.
+   */
+  StrategyExtractionMode mode = StrategyExtractionMode::SolveEqn;
+
+  /**
+   * \brief Number of new BDD nodes SolveEqn may create before falling back to the Skolem mode.
+   *
+   * 0 means no limit.
+   */
+  std::size_t node_budget = 0;
+
+  /**
+   * \brief Extract independent clusters of outputs separately.
+   *
+   * A cluster is a connected component of the interaction graph of the
+   * outputs. Each cluster is extracted from the projection of the winning
+   * moves on its outputs, which keeps the intermediate BDDs small.
+   */
+  bool decompose = false;
+
+  /**
+   * \brief Keep the winning moves and answer strategy queries on demand instead of extracting output functions.
+   */
+  bool lazy = false;
+};
+
+/**
+ * \brief Extracts output functions from the winning moves of a DFA game.
+ *
+ * Shared by the adversarial and cooperative game synthesizers.
+ */
+class StrategyExtractor {
+ private:
+
+  std::shared_ptr<VarMgr> var_mgr_;
+  Player protagonist_player_;
+  StrategyExtractionOptions options_;
+
+  std::vector<std::string> controlled_variable_labels() const;
+
+  CUDD::BDD variable_cube(const std::vector<int>& indices) const;
+
+  std::vector<int> controlled_indices() const;
+
+  /**
+   * \brief Returns, for each controlled variable, the controlled variables it interacts with.
+   *
+   * Two variables interact if the Boolean difference of the winning moves
+   * with respect to one of them depends on the other.
+   */
+  std::unordered_map<int, std::set<int>> interaction_graph(
+      const CUDD::BDD& winning_moves,
+      const std::vector<int>& outputs) const;
+
+  /**
+   * \brief Orders the controlled variables for the Skolem mode.
+   *
+   * Variables are quantified out in min-degree order on the interaction
+   * graph, so the last variable of the returned order is quantified first.
+   */
+  std::vector<int> skolem_order(const CUDD::BDD& winning_moves,
+                                const std::vector<int>& outputs) const;
+
+  /**
+   * \brief Splits the controlled variables into clusters that can be extracted independently.
+   *
+   * Returns a single cluster when the winning moves are not the conjunction
+   * of their projections on the connected components of the interaction graph.
+   */
+  std::vector<std::vector<int>> independent_clusters(
+      const CUDD::BDD& winning_moves,
+      const std::vector<int>& outputs) const;
+
+  /**
+   * \brief Extracts the functions of the given outputs with the configured mode.
+   */
+  std::unordered_map<int, CUDD::BDD> extract_cluster(
+      const CUDD::BDD& winning_moves,
+      const std::vector<int>& outputs) const;
+
+  std::unordered_map<int, CUDD::BDD> extract_solve_eqn(
+      const CUDD::BDD& winning_moves,
+      const std::vector<int>& outputs) const;
+
+  std::unordered_map<int, CUDD::BDD> extract_skolem(
+      const CUDD::BDD& winning_moves,
+      const std::vector<int>& outputs) const;
+
+ public:
+
+  /**
+   * \brief Constructs an extractor for the variables controlled by a player.
+   *
+   * \param var_mgr The variable manager of the game.
+   * \param protagonist_player The player whose variables are extracted:
+   *   output variables for the agent, input variables for the environment.
+   * \param options Extraction options.
+   */
+  StrategyExtractor(std::shared_ptr<VarMgr> var_mgr,
+                    Player protagonist_player,
+                    StrategyExtractionOptions options = StrategyExtractionOptions());
+
+  /**
+   * \brief Computes one function per controlled variable that always picks a winning move.
+   *
+   * \param winning_moves A BDD over state, input and output variables that
+   *   holds for the moves that keep the protagonist in its winning region.
+   * \return A map from the index of each controlled variable to a BDD over
+   *   the remaining variables.
+   */
+  std::unordered_map<int, CUDD::BDD> extract(const CUDD::BDD& winning_moves) const;
+
+  /**
+   * \brief Stores a strategy for the winning moves of a game in \a result.
+   *
+   * Stores a LazyStrategyOracle if the options ask for one, and a transducer
+   * built from the extracted output functions otherwise. The transducer is
+   * not minimized, since the final controller may merge several games.
+   *
+   * \param result The result of the game.
+   * \param arena The arena of the game.
+   * \param starting_player The player that moves first each turn.
+   * \param winning_moves The winning moves, as passed to extract.
+   */
+  void attach_strategy(SynthesisResult& result,
+                       const SymbolicStateDfa& arena,
+                       Player starting_player,
+                       const CUDD::BDD& winning_moves) const;
+};
+
+}
+
+#endif // STRATEGY_EXTRACTOR_H
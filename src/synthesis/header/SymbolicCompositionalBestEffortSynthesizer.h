@@ -6,6 +6,7 @@
 #ifndef SYFT_SYMBOLICCOMPOSITIONALBESTEFFORTSYNTHESIZER_H
 #define SYFT_SYMBOLICCOMPOSITIONALBESTEFFORTSYNTHESIZER_H
 
+#include"AnytimeOptions.h"
 #include"ExplicitStateDfaMona.h"
 #include"ExplicitStateDfa.h"
 #include"SymbolicStateDfa.h"
@@ -17,6 +18,19 @@
 
 namespace Syft {
 
+	/**
+	 * \brief Bounds on the winning regions of the games, known from a related problem
+	 *
+	 * A state outside a bound is treated as losing without being explored.
+	 */
+	struct WinningRegionBounds {
+		CUDD::BDD adversarial;
+		CUDD::BDD cooperative;
+		// Used instead of solving the negated-environment game if reuse_non_environment is set
+		CUDD::BDD non_environment;
+		bool reuse_non_environment = false;
+	};
+
 	class SymbolicCompositionalBestEffortSynthesizer {
 	
 		protected:
@@ -27,12 +41,30 @@ namespace Syft {
 
 			Player starting_player_;
 
+			StrategyExtractionOptions extraction_options_;
+
 			std::vector<SymbolicStateDfa> symbolic_dfas_;
 			std::vector<SymbolicStateDfa> arena_;
+			// Compose vector of the transition function of arena_[0], shared by the
+			// adversarial and negated-environment games of every solve
+			std::vector<CUDD::BDD> arena_transition_vector_;
 
 			InputOutputPartition partition_;
 
 			std::vector<double> running_times_;
+
+			AnytimeOptions anytime_options_;
+
+			bool has_bounds_ = false;
+			WinningRegionBounds bounds_;
+			CUDD::BDD non_environment_winning_region_;
+
+			/**
+			 * @brief Solves the adversarial and cooperative games on the arena, with the given player moving first
+			 *
+			 * Appends the running times of both games to running_times_.
+			 */
+			std::pair<SynthesisResult, SynthesisResult> solve(Player starting_player);
 		public:
 		
 			/**
@@ -43,14 +75,36 @@ namespace Syft {
 			* \param environment_assumption LTLf environment specification in Lydia syntax
 			* \param partition Partitioning of problem variables
 			* \param starting_player Player who moves first each turn
+			* \param extraction_options Options for extracting output functions
 			* 
 			*/
 			SymbolicCompositionalBestEffortSynthesizer(std::shared_ptr<VarMgr> var_mgr,
 									std::string agent_specification,
 									std::string environment_specification,
 									InputOutputPartition partition,
-									Player starting_player);
+									Player starting_player,
+									StrategyExtractionOptions extraction_options = StrategyExtractionOptions());
 			
+			/**
+			* \brief Construct an object presenting best-effort synthesis problem (E, Phi) from symbolic DFAs built elsewhere
+			*
+			* Only the product is constructed, so get_running_times() reports the game phases only.
+			*
+			* \param var_mgr Dictionary storing variables of the problem, shared with the DFAs
+			* \param agent_dfa Symbolic DFA A_{phi} of the agent goal
+			* \param environment_dfa Symbolic DFA A_{E} of the environment specification
+			* \param tautology_dfa Symbolic DFA A_{tt}, accepting non-empty traces only
+			* \param starting_player Player who moves first each turn
+			* \param extraction_options Options for extracting output functions
+			*
+			*/
+			SymbolicCompositionalBestEffortSynthesizer(std::shared_ptr<VarMgr> var_mgr,
+									SymbolicStateDfa agent_dfa,
+									SymbolicStateDfa environment_dfa,
+									SymbolicStateDfa tautology_dfa,
+									Player starting_player,
+									StrategyExtractionOptions extraction_options = StrategyExtractionOptions());
+
 			/**
 			 * @brief Solves symbolic DFA games to compute adversarially and cooperatively winning strategies
 			 * 
@@ -59,16 +113,42 @@ namespace Syft {
 			virtual std::pair<SynthesisResult, SynthesisResult> run() final;
 
 			/**
-			* \brief Merges two transducers into a best-effort strategy
-			*
-			* \param adversarial_result Reactive synthesis result
-			* \param coopeartive_result Cooperative synthesis result
-			* \param filename A path to the output .dot file
-			* \return void. Prints implementation function of best-effort strategy into a .dot file
-			*/
-			void merge_and_dump_dot(const SynthesisResult& adversarial_result, 
-									const SynthesisResult& cooperative_result, 
-									const string& filename) const;
+			 * @brief Solves the symbolic DFA games with the given player moving first, instead of the one passed to the constructor
+			 *
+			 * Can be called once per starting player to solve both games on the same arena. Each call
+			 * appends its adversarial and cooperative game times to get_running_times().
+			 *
+			 * @return std::pair<SynthesisResult, SynthesisResult>, as run().
+			 */
+			std::pair<SynthesisResult, SynthesisResult> run(Player starting_player);
+
+
+			/**
+			 * @brief Sets how the games are reported as soon as they are solved, and whether the cooperative game may be skipped
+			 *
+			 * @param anytime_options Options applying to the next calls of run()
+			 */
+			void set_anytime_options(AnytimeOptions anytime_options);
+
+			/**
+			 * @brief Restricts the games of the next calls of run() to the given bounds on their winning regions
+			 *
+			 * The bounds must contain the winning regions of the games, e.g. because they are the winning
+			 * regions of a problem with a weaker goal.
+			 */
+			void set_winning_region_bounds(WinningRegionBounds bounds);
+
+			/**
+			 * @brief Returns the winning region of the agent in the negated-environment game of the last run
+			 */
+			CUDD::BDD non_environment_winning_region() const;
+
+			/**
+			 * @brief Returns whether some transition of the arena leads back to its initial state
+			 *
+			 * @param restricted Whether to check the arena of the cooperative game of the last run instead
+			 */
+			bool reenters_initial_state(bool restricted) const;
 
 			/**
 			 * @brief Returns running times of major operations during synthesis
@@ -26,19 +26,10 @@ class SymbolicStateDfa {
 
   SymbolicStateDfa(std::shared_ptr<VarMgr> var_mgr);
 
-  static std::pair<std::size_t, std::size_t> create_state_variables(
-      std::shared_ptr<VarMgr>& mgr,
-      std::size_t state_count);
-  
   static CUDD::BDD state_to_bdd(const std::shared_ptr<VarMgr>& mgr,
 				std::size_t automaton_id,
 				std::size_t state);
 
-  static CUDD::BDD state_set_to_bdd(
-      const std::shared_ptr<VarMgr>& mgr,
-      std::size_t automaton_id,
-      const std::vector<size_t>& states);
-
   static std::vector<CUDD::BDD> symbolic_transition_function(
       const std::shared_ptr<VarMgr>& mgr,
       std::size_t automaton_id,
@@ -46,6 +37,27 @@ class SymbolicStateDfa {
 
  public:
 
+  /**
+   * \brief Creates enough state variables to encode \a state_count states.
+   *
+   * \return A pair containing the number of state variables created and the
+   *   automaton ID they are associated with.
+   */
+  static std::pair<std::size_t, std::size_t> create_state_variables(
+      std::shared_ptr<VarMgr>& mgr,
+      std::size_t state_count);
+
+  /**
+   * \brief Converts a set of explicit states to a BDD.
+   *
+   * State \a i is encoded by the binary representation of \a i over the state
+   * variables of the given automaton, as done by \a from_explicit.
+   */
+  static CUDD::BDD state_set_to_bdd(
+      const std::shared_ptr<VarMgr>& mgr,
+      std::size_t automaton_id,
+      const std::vector<size_t>& states);
+
   /**
    * \brief Converts an explicit DFA to a symbolic representation.
    *
@@ -0,0 +1,129 @@
+#ifndef SYNTHESIS_DAEMON_H
+#define SYNTHESIS_DAEMON_H
+
+#include <istream>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+
+#include "StrategyExtractor.h"
+#include "SynthesisSession.h"
+
+namespace Syft {
+
+/**
+ * \brief Answers best-effort synthesis requests in a long-running process.
+ *
+ * Each request is a JSON object on a single line, and so is each response.
+ * Requests are solved with the symbolic-compositional algorithm in a
+ * SynthesisSession, one per partition and starting player, so the DFAs of
+ * formulas and the BDD manager stay warm between requests. At most
+ * max_sessions sessions are kept, dropping the least recently used one, and a
+ * session holding max_cached_dfas DFAs starts afresh before its next new
+ * problem, so a long-running daemon does not grow without bound.
+ *
+ * A request holds the fields
+ *   "goal": the LTLf agent goal, required;
+ *   "assumption": the LTLf environment assumption, "true" by default;
+ *   "add_goal" or "add_assumption": instead of "goal" and "assumption", a
+ *     conjunct added to the last problem of the session, which is solved
+ *     again reusing its winning regions where sound;
+ *   "inputs" and "outputs": arrays of variable names, or "partition": the
+ *     name of a partition file;
+ *   "starting_player": "agent" or "environment" (the default);
+ *   "strategy": true to return the best-effort strategy as an ASCII AIGER
+ *     circuit;
+ *   "timeout": a time limit in seconds;
+ *   "id": any value, copied to the response.
+ *
+ * A response holds "verdict" (Adv, Coop, Unr or TIMEOUT), "times" (LTLf2DFA,
+ * DFA2Sym, adversarial and cooperative game, in seconds), "total",
+ * "cached_dfas" and, if requested, "strategy". Invalid requests get a
+ * response with an "error" field instead.
+ */
+class SynthesisDaemon {
+ private:
+
+  struct WarmSession {
+    std::unique_ptr<SynthesisSession> session;
+    // Value of request_count_ when the session last served a request
+    std::size_t last_request;
+  };
+
+  StrategyExtractionOptions extraction_options_;
+  double default_timeout_;
+  DontCareMinimization minimization_;
+  std::size_t max_sessions_;
+  std::size_t max_cached_dfas_;
+  std::map<std::pair<std::string, Player>, WarmSession> sessions_;
+  std::size_t request_count_;
+
+  /**
+   * \brief Returns the session of a partition and starting player, creating it if needed.
+   *
+   * \param fresh Whether the request states a new problem, so that a session
+   *   holding too many DFAs can be replaced.
+   */
+  SynthesisSession& session(const InputOutputPartition& partition,
+                            Player starting_player, bool fresh);
+
+ public:
+
+  /**
+   * \brief Creates a daemon with no warm sessions.
+   *
+   * \param extraction_options Options for extracting output functions.
+   * \param default_timeout Time limit of the requests without a "timeout"
+   *   field, in seconds (0 = no limit).
+   * \param minimization Operator used to simplify the returned strategies
+   *   outside their winning reachable states.
+   * \param max_sessions Number of sessions kept warm (0 = no limit).
+   * \param max_cached_dfas Number of DFAs a session caches before it is
+   *   replaced by a fresh one (0 = no limit).
+   */
+  explicit SynthesisDaemon(StrategyExtractionOptions extraction_options = StrategyExtractionOptions(),
+                           double default_timeout = 0,
+                           DontCareMinimization minimization = DontCareMinimization::None,
+                           std::size_t max_sessions = 16,
+                           std::size_t max_cached_dfas = 4096);
+
+  /**
+   * \brief Answers a single request.
+   *
+   * \param request A JSON object.
+   * \return The JSON response, without a trailing newline.
+   */
+  std::string handle(const std::string& request);
+
+  /**
+   * \brief Answers each line of \a in with a line on \a out, until \a in ends or synthesis is cancelled.
+   */
+  void serve(std::istream& in, std::ostream& out);
+
+  /**
+   * \brief Listens on a UNIX domain socket and answers the requests of all its connections.
+   *
+   * Waits on the listener and on every open connection at once, and answers
+   * one request of each ready connection in turn, so an idle or busy client
+   * does not hold up the others. Requests are still solved one at a time.
+   * Replaces any file at \a path, and removes the socket when synthesis is
+   * cancelled. Throws a std::runtime_error if the socket cannot be created.
+   */
+  void serve_socket(const std::string& path);
+
+  /**
+   * \brief Returns the number of requests answered so far.
+   */
+  std::size_t request_count() const;
+
+  /**
+   * \brief Returns the number of sessions kept warm.
+   */
+  std::size_t session_count() const;
+};
+
+}
+
+#endif // SYNTHESIS_DAEMON_H
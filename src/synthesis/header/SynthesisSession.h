@@ -0,0 +1,186 @@
+#ifndef SYNTHESIS_SESSION_H
+#define SYNTHESIS_SESSION_H
+
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ExplicitStateDfa.h"
+#include "ExplicitStateDfaMona.h"
+#include "InputOutputPartition.h"
+#include "StrategyExtractor.h"
+#include "Synthesizer.h"
+#include "SymbolicCompositionalBestEffortSynthesizer.h"
+#include "SymbolicStateDfa.h"
+#include "VarMgr.h"
+
+namespace Syft {
+
+/**
+ * \brief Runs symbolic-compositional best-effort synthesis on many goal/assumption pairs over one partition.
+ *
+ * The session owns a single VarMgr and caches the DFAs of the formulas it has
+ * seen, in their MONA, explicit and symbolic forms. A run on a new pair only
+ * translates the formulas not in the cache, then builds the product and solves
+ * the games. This works for a goal swept across assumptions as well as for
+ * assumptions swept across goals.
+ *
+ * The session also keeps the components and winning regions of the last
+ * problem it solved, so that the problem can be extended one conjunct at a
+ * time.
+ */
+class SynthesisSession {
+ private:
+
+  struct CachedDfa {
+    ExplicitStateDfaMona mona_dfa;
+    ExplicitStateDfa explicit_dfa;
+    SymbolicStateDfa symbolic_dfa;
+  };
+
+  std::shared_ptr<VarMgr> var_mgr_;
+  std::unordered_set<std::string> partition_variables_;
+  Player starting_player_;
+  StrategyExtractionOptions extraction_options_;
+
+  std::unordered_map<std::string, CachedDfa> dfas_;
+  std::size_t hit_count_;
+  std::size_t miss_count_;
+
+  std::vector<double> running_times_;
+
+  // Last problem solved, as conjuncts of the goal and of the assumption
+  std::vector<std::string> goal_conjuncts_;
+  std::vector<std::string> assumption_conjuncts_;
+  std::vector<SymbolicStateDfa> goal_dfas_;
+  std::vector<SymbolicStateDfa> assumption_dfas_;
+  std::vector<SymbolicStateDfa> tautology_dfa_;
+  bool solved_;
+  WinningRegionBounds last_regions_;
+  bool adversarial_fixpoint_;
+  bool cooperative_fixpoint_;
+  bool reenters_initial_state_;
+  bool reenters_restricted_initial_state_;
+
+  /**
+   * \brief Translates the formulas that are not cached, and records the LTLf2DFA time.
+   *
+   * \return The time spent on the symbolic DFAs of the new formulas, in seconds.
+   */
+  double translate(const std::vector<std::string>& formulas);
+
+  /**
+   * \brief Returns the symbolic DFA of a translated formula, with state variables not in \a used_automata.
+   *
+   * Adds the automaton id of the returned DFA to \a used_automata.
+   */
+  SymbolicStateDfa component_dfa(const std::string& formula,
+                                 std::set<std::size_t>& used_automata);
+
+  /**
+   * \brief Solves the games on the product of the current components and keeps their winning regions.
+   *
+   * \param conversion_time The time already spent on symbolic DFAs, added to DFA2Sym.
+   * \param bounds Bounds on the winning regions, or nullptr.
+   */
+  std::pair<SynthesisResult, SynthesisResult> solve(double conversion_time,
+                                                    const WinningRegionBounds* bounds);
+
+  /**
+   * \brief Throws a std::runtime_error if the last run did not complete.
+   */
+  void check_last_problem() const;
+
+ public:
+
+  /**
+   * \brief Creates a session whose formulas range over the variables of \a partition.
+   *
+   * \param partition Partitioning of the variables of every formula of the session.
+   * \param starting_player Player who moves first each turn.
+   * \param extraction_options Options for extracting output functions.
+   */
+  SynthesisSession(const InputOutputPartition& partition,
+                   Player starting_player,
+                   StrategyExtractionOptions extraction_options = StrategyExtractionOptions());
+
+  /**
+   * \brief Solves the best-effort synthesis problem (E, phi), reusing the cached DFAs.
+   *
+   * Throws a std::runtime_error if a formula mentions a variable outside the partition.
+   *
+   * \return The adversarially and cooperatively winning strategies, as
+   *   SymbolicCompositionalBestEffortSynthesizer::run.
+   */
+  std::pair<SynthesisResult, SynthesisResult> run(const std::string& agent_specification,
+                                                  const std::string& environment_assumption);
+
+  /**
+   * \brief Solves (E, phi && psi), where (E, phi) is the last problem solved and psi a new goal conjunct.
+   *
+   * Only psi is translated, and its DFA is added to the components of the
+   * last arena. A stronger goal can only shrink the winning regions, so the
+   * adversarial and cooperative games only explore the winning regions of
+   * the last problem, when these were computed to the fixpoint and the
+   * initial state of the arena cannot be re-entered. The negated-environment
+   * game is not solved again.
+   *
+   * Throws a std::runtime_error if the last run did not complete.
+   */
+  std::pair<SynthesisResult, SynthesisResult> add_goal_conjunct(const std::string& conjunct);
+
+  /**
+   * \brief Solves (E && chi, phi), where (E, phi) is the last problem solved and chi a new assumption conjunct.
+   *
+   * Only chi is translated, and its DFA is added to the components of the
+   * last arena. A stronger assumption can grow the winning regions, so the
+   * games are solved on the whole arena.
+   *
+   * Throws a std::runtime_error if the last run did not complete.
+   */
+  std::pair<SynthesisResult, SynthesisResult> add_assumption_conjunct(const std::string& conjunct);
+
+  /**
+   * \brief Returns the goal of the last problem solved, as the conjunction of its conjuncts.
+   */
+  std::string agent_specification() const;
+
+  /**
+   * \brief Returns the assumption of the last problem solved, as the conjunction of its conjuncts.
+   */
+  std::string environment_assumption() const;
+
+  /**
+   * \brief Returns the running times of the last run, in the layout of the best-effort synthesizers.
+   *
+   * LTLf2DFA and DFA2Sym only account for the formulas that were not cached.
+   */
+  std::vector<double> get_running_times() const;
+
+  /**
+   * \brief Returns the variable manager shared by all runs.
+   */
+  std::shared_ptr<VarMgr> var_mgr() const;
+
+  /**
+   * \brief Returns the number of formulas whose DFAs are cached.
+   */
+  std::size_t cached_dfa_count() const;
+
+  /**
+   * \brief Returns how many DFA lookups were answered from the cache.
+   */
+  std::size_t hit_count() const;
+
+  /**
+   * \brief Returns how many DFA lookups required a translation.
+   */
+  std::size_t miss_count() const;
+};
+
+}
+
+#endif // SYNTHESIS_SESSION_H
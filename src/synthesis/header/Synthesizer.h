@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "LazyStrategyOracle.h"
 #include "Transducer.h"
 #include <tuple>
 
@@ -11,6 +12,8 @@ namespace Syft {
         bool realizability;
         CUDD::BDD winning_states;
         std::unique_ptr<Transducer> transducer;
+        // Set instead of the transducer when the strategy is queried lazily
+        std::unique_ptr<LazyStrategyOracle> strategy_oracle;
     };
 
 /**
@@ -7,11 +7,17 @@
 
 #include <cuddObj.hh>
 
+#include "Aig.h"
 #include "Player.h"
 #include "VarMgr.h"
 
 namespace Syft {
 
+/**
+ * \brief Operator used to simplify output functions outside their care set.
+ */
+enum class DontCareMinimization {None, Restrict, LICompaction, Squeeze};
+
 /**
  * \brief A symbolic tranducer representing a winning strategy for a game.
  *
@@ -19,16 +25,21 @@ namespace Syft {
  */
 class Transducer {
 
-  friend class SymbolicCompositionalBestEffortSynthesizer;
-  friend class MonolithicBestEffortSynthesizer;
-  friend class ExplicitCompositionalBestEffortSynthesizer;
+  friend class TransducerExecutor;
+  friend class BitSlicedController;
+  friend class ControllerBenchmark;
+  friend class MealyMachine;
 
- private:
+ protected:
 
   std::shared_ptr<VarMgr> var_mgr_;
 
+  std::size_t automaton_id_;
   std::vector<int> initial_vector_;
-  std::unordered_map<int, CUDD::BDD> output_function_;
+  // output_function_[i] is the function of the variable with index
+  // output_indices_[i], in the order of the protagonist's variable labels
+  std::vector<int> output_indices_;
+  std::vector<CUDD::BDD> output_function_;
   std::vector<CUDD::BDD> transition_function_;
   Player starting_player_;
   Player protagonist_player_;
@@ -36,17 +47,85 @@ class Transducer {
  public:
 
   Transducer(std::shared_ptr<VarMgr> var_mgr,
+             std::size_t automaton_id,
              std::vector<int> initial_vector,
              std::unordered_map<int, CUDD::BDD> output_function,
              std::vector<CUDD::BDD> transition_function,
              Player starting_player,
              Player protagonist_player = Player::Agent);
 
+  virtual ~Transducer() = default;
+
+  /**
+   * \brief Returns the labels of the variables the transducer reads.
+   *
+   * These are the variables of the player the transducer plays against.
+   */
+  std::vector<std::string> input_labels() const;
+
+  /**
+   * \brief Returns the labels of the variables the transducer outputs.
+   */
+  std::vector<std::string> output_labels() const;
+
+  /**
+   * \brief Returns the indices of the variables the transducer outputs, in label order.
+   */
+  const std::vector<int>& output_indices() const;
+
+  /**
+   * \brief Returns the output functions, aligned with output_indices().
+   */
+  const std::vector<CUDD::BDD>& output_functions() const;
+
+  /**
+   * \brief Returns the output function of the variable with the given index.
+   */
+  CUDD::BDD output_function(int index) const;
+
   /**
    * \brief Saves the output function of the transducer in a .dot file.
    */
   void dump_dot(const std::string& filename) const;
 
+  /**
+   * \brief Converts the transducer into a sequential circuit.
+   *
+   * Inputs of the circuit are the variables of the player the transducer
+   * plays against, latches are the state variables and outputs are the
+   * protagonist's variables. Every BDD node becomes a multiplexer.
+   */
+  Aig to_aig() const;
+
+  /**
+   * \brief Saves the transducer as a balanced AIGER circuit.
+   *
+   * Uses the binary format if \a filename ends in .aig and the ASCII format
+   * otherwise. Prints the number of AND gates and latches.
+   */
+  void dump_aiger(const std::string& filename) const;
+
+  /**
+   * \brief Returns the states reachable from the initial state when the protagonist follows the transducer.
+   *
+   * Holds the successor states in the scratch state variables of the
+   * VarMgr, so no variables are added to the manager.
+   */
+  CUDD::BDD reachable_states() const;
+
+  /**
+   * \brief Simplifies every output function outside the winning reachable states.
+   *
+   * The care set is \a winning_states conjoined with reachable_states(). On
+   * the care set the output functions are unchanged, so the states reachable
+   * from the initial state are the same as before. Prints the node count of
+   * each output function before and after.
+   *
+   * \param winning_states The winning states of the protagonist.
+   * \param method The operator used to simplify each output function.
+   */
+  void minimize(const CUDD::BDD& winning_states, DontCareMinimization method);
+
 };
 
 }
@@ -0,0 +1,116 @@
+#ifndef TRANSDUCER_EXECUTOR_H
+#define TRANSDUCER_EXECUTOR_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Transducer.h"
+
+namespace Syft {
+
+/**
+ * \brief Runs a transducer on input traces without going through CUDD.
+ *
+ * The output functions and the transition function are copied into a single
+ * array of nodes when the executor is constructed. Each step evaluates them
+ * by walking that array with a flat valuation of all BDD variables, so the
+ * executor does not depend on the CUDD manager afterwards.
+ *
+ * Inputs are the variables of the player the transducer plays against, in
+ * label order, and outputs are the variables of the protagonist, in the order
+ * of Transducer::output_indices. Letters hold one byte per variable, 0 or 1.
+ */
+class TransducerExecutor {
+ public:
+
+  /**
+   * \brief A node of the flattened BDDs.
+   *
+   * Edges are node positions shifted left by one, with the lowest bit set if
+   * the edge is complemented. Position 0 is the constant 1.
+   */
+  struct Node {
+    std::uint32_t variable;
+    std::uint32_t then_edge;
+    std::uint32_t else_edge;
+  };
+
+ private:
+
+  std::vector<Node> nodes_;
+
+  std::vector<std::uint32_t> input_indices_;
+  std::vector<std::uint32_t> output_indices_;
+  std::vector<std::uint32_t> state_indices_;
+  std::vector<std::uint32_t> output_roots_;
+  std::vector<std::uint32_t> transition_roots_;
+  std::vector<std::uint8_t> initial_state_;
+
+  std::vector<std::uint8_t> valuation_;
+  std::vector<std::uint8_t> next_state_;
+
+  std::uint32_t flatten(DdNode* node,
+                        std::unordered_map<DdNode*, std::uint32_t>& positions);
+
+  bool evaluate(std::uint32_t root) const;
+
+ public:
+
+  /**
+   * \brief Flattens the functions of a transducer and sets the executor to its initial state.
+   */
+  explicit TransducerExecutor(const Transducer& transducer);
+
+  /**
+   * \brief Returns to the initial state of the transducer.
+   */
+  void reset();
+
+  /**
+   * \brief Reads one input letter, writes the output letter and moves to the next state.
+   *
+   * \param input input_count() bytes, one per input variable.
+   * \param output output_count() bytes, one per output variable.
+   */
+  void step(const std::uint8_t* input, std::uint8_t* output);
+
+  /**
+   * \brief Runs a trace from the initial state.
+   *
+   * Throws std::invalid_argument if the trace ends in the middle of a letter.
+   *
+   * \param inputs The input letters of the trace, one after the other.
+   * \return The output letters of the trace, one after the other.
+   */
+  std::vector<std::uint8_t> run(const std::vector<std::uint8_t>& inputs);
+
+  /**
+   * \brief Runs every trace from the initial state.
+   */
+  std::vector<std::vector<std::uint8_t>> run_batch(
+      const std::vector<std::vector<std::uint8_t>>& traces);
+
+  /**
+   * \brief Returns the current state, one byte per state variable.
+   */
+  std::vector<std::uint8_t> state() const;
+
+  /**
+   * \brief Moves to the given state, one byte per state variable.
+   */
+  void set_state(const std::vector<std::uint8_t>& state);
+
+  std::size_t input_count() const;
+
+  std::size_t output_count() const;
+
+  /**
+   * \brief Returns the number of nodes in the flattened BDDs.
+   */
+  std::size_t node_count() const;
+};
+
+}
+
+#endif // TRANSDUCER_EXECUTOR_H
@@ -22,15 +22,30 @@ class VarMgr {
   std::vector<std::vector<CUDD::BDD>> state_variables_; // Z variables
   std::vector<CUDD::BDD> input_variables_;              // X variables
   std::vector<CUDD::BDD> output_variables_;             // Y variables
+  bool has_scratch_state_variables_;
+  std::size_t scratch_automaton_id_;    // reused by temporary encodings
   // std::size_t total_variable_count_;    // number of Z, X and Y variables
 
   public:
 
   /**
    * \brief Constructs a VarMgr with no variables.
+   *
+   * CUDD operations on the manager stop with a SynthesisTimeout once
+   * synthesis is cancelled, see watch_cancellation.
    */
   VarMgr();
 
+  /**
+   * \brief Registers the CUDD termination callback that polls CancellationToken.
+   *
+   * CUDD polls the callback while it builds new nodes, so that a single long
+   * operation, such as a preimage or SolveEqn, stops soon after the deadline.
+   * Code that registers a termination callback of its own calls this again
+   * when it is done.
+   */
+  void watch_cancellation() const;
+
   /**
    * \brief Creates BDD variables and associates each with a name.
    *
@@ -254,6 +269,19 @@ class VarMgr {
     * \return an ID to be used later.
     */
     std::size_t copy_state_variables(std::size_t automaton_id);
+
+    /**
+    * \brief Returns state variables for encodings that only live during a computation
+    *
+    * The variables are created on the first call and reused afterwards, so
+    * computations such as image steps over a primed copy of the state space
+    * do not add variables to the manager each time they run. A BDD over these
+    * variables must not be kept once the computation is over.
+    *
+    * \param variable_count The number of variables needed.
+    * \return An ID whose first \a variable_count state variables may be used.
+    */
+    std::size_t scratch_state_variables(std::size_t variable_count);
 };
 
 }
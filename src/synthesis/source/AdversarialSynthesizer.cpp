@@ -5,6 +5,7 @@
 */
 
 #include "AdversarialSynthesizer.h"
+#include "CancellationToken.h"
 #include <boost/algorithm/string.hpp>
 #include <queue>
 
@@ -15,13 +16,16 @@ namespace Syft {
                             std::string agent_specification,
                             std::string environment_specification,
                             InputOutputPartition partition,
-                            Player starting_player) :   
+                            Player starting_player,
+                            StrategyExtractionOptions extraction_options) :   
                                 var_mgr_(var_mgr),
                                 agent_specification_(agent_specification),
                                 environment_specification_(environment_specification),
                                 partition_(partition),
-                                starting_player_(starting_player)
+                                starting_player_(starting_player),
+                                extraction_options_(extraction_options)
     {
+        RunningTimesScope running_times_scope(running_times_);
 
         // step 1. Construct symbolic DFA of LTLf formula E -> Phi
         Stopwatch ltlf2dfa;
@@ -60,6 +64,8 @@ namespace Syft {
 
     SynthesisResult AdversarialSynthesizer::run() 
     {
+        RunningTimesScope running_times_scope(running_times_);
+
         SynthesisResult adv_result;
         CUDD::BDD adv_goal = symbolic_dfa_[0].final_states();
 
@@ -71,7 +77,8 @@ namespace Syft {
                                                 starting_player_,
                                                 Player::Agent,
                                                 adv_goal, // Lifting
-                                                var_mgr_->cudd_mgr()->bddOne());
+                                                var_mgr_->cudd_mgr()->bddOne(),
+                                                extraction_options_);
         adv_result = adv_synthesizer.run();
         double t_advGame = advGame.stop().count() / 1000.0;
         running_times_.push_back(t_advGame);
@@ -0,0 +1,359 @@
+#include "Aig.h"
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace Syft {
+
+namespace {
+
+void write_unsigned(std::ofstream& out, unsigned int value) {
+  while (value & ~0x7fu) {
+    out.put(static_cast<char>((value & 0x7fu) | 0x80u));
+    value >>= 7;
+  }
+
+  out.put(static_cast<char>(value));
+}
+
+}
+
+unsigned int Aig::first_and_variable() const {
+  return 1 + input_names_.size() + latches_.size();
+}
+
+bool Aig::is_and(unsigned int variable) const {
+  return variable >= first_and_variable();
+}
+
+const Aig::AndGate& Aig::and_gate(unsigned int variable) const {
+  return and_gates_[variable - first_and_variable()];
+}
+
+std::size_t Aig::level(Literal literal) const {
+  unsigned int variable = literal >> 1;
+
+  return is_and(variable) ? levels_[variable - first_and_variable()] : 0;
+}
+
+Aig::Literal Aig::add_input(const std::string& name) {
+  if (!latches_.empty() || !and_gates_.empty()) {
+    throw std::runtime_error(
+        "Error: AIG inputs must be added before latches and AND gates.");
+  }
+
+  input_names_.push_back(name);
+
+  return 2 * input_names_.size();
+}
+
+Aig::Literal Aig::add_latch(const std::string& name, bool initial_value) {
+  if (!and_gates_.empty()) {
+    throw std::runtime_error("Error: AIG latches must be added before AND gates.");
+  }
+
+  latch_names_.push_back(name);
+  latches_.push_back({false_literal, initial_value});
+
+  return 2 * (input_names_.size() + latches_.size());
+}
+
+void Aig::set_latch_next(std::size_t latch, Literal next) {
+  latches_.at(latch).next = next;
+}
+
+void Aig::add_output(const std::string& name, Literal literal) {
+  output_names_.push_back(name);
+  outputs_.push_back(literal);
+}
+
+Aig::Literal Aig::make_and(Literal left, Literal right) {
+  if (left > right) {
+    std::swap(left, right);
+  }
+
+  // Constants have the smallest literals, so only left can be constant
+  if (left == false_literal) {
+    return false_literal;
+  } else if (left == true_literal || left == right) {
+    return right;
+  } else if ((left ^ 1) == right) {
+    return false_literal;
+  }
+
+  unsigned long long key =
+      (static_cast<unsigned long long>(right) << 32) | left;
+  auto found = strash_.find(key);
+
+  if (found != strash_.end()) {
+    return found->second;
+  }
+
+  Literal literal = 2 * (first_and_variable() + and_gates_.size());
+  and_gates_.push_back({right, left});
+  levels_.push_back(1 + std::max(level(left), level(right)));
+  strash_.emplace(key, literal);
+
+  return literal;
+}
+
+Aig::Literal Aig::make_or(Literal left, Literal right) {
+  return make_and(left ^ 1, right ^ 1) ^ 1;
+}
+
+Aig::Literal Aig::make_mux(Literal selector,
+                           Literal then_literal,
+                           Literal else_literal) {
+  if (then_literal == else_literal || selector == true_literal) {
+    return then_literal;
+  } else if (selector == false_literal) {
+    return else_literal;
+  } else if (then_literal == true_literal) {
+    return make_or(selector, else_literal);
+  } else if (then_literal == false_literal) {
+    return make_and(selector ^ 1, else_literal);
+  } else if (else_literal == true_literal) {
+    return make_or(selector ^ 1, then_literal);
+  } else if (else_literal == false_literal) {
+    return make_and(selector, then_literal);
+  }
+
+  return make_or(make_and(selector, then_literal),
+                 make_and(selector ^ 1, else_literal));
+}
+
+Aig Aig::balance() const {
+  Aig balanced;
+
+  for (const std::string& name : input_names_) {
+    balanced.add_input(name);
+  }
+
+  for (std::size_t i = 0; i < latches_.size(); ++i) {
+    balanced.add_latch(latch_names_[i], latches_[i].initial_value);
+  }
+
+  std::vector<std::size_t> fanout(and_gates_.size(), 0);
+
+  auto count = [&] (Literal literal) {
+    if (is_and(literal >> 1)) {
+      ++fanout[(literal >> 1) - first_and_variable()];
+    }
+  };
+
+  for (const AndGate& gate : and_gates_) {
+    count(gate.left);
+    count(gate.right);
+  }
+
+  for (const Latch& latch : latches_) {
+    count(latch.next);
+  }
+
+  for (Literal output : outputs_) {
+    count(output);
+  }
+
+  const Literal unmapped = std::numeric_limits<Literal>::max();
+  std::vector<Literal> mapped(first_and_variable() + and_gates_.size(), unmapped);
+
+  for (unsigned int variable = 0; variable < first_and_variable(); ++variable) {
+    mapped[variable] = 2 * variable;
+  }
+
+  std::function<Literal(Literal)> rebuild = [&] (Literal literal) {
+    unsigned int variable = literal >> 1;
+
+    if (mapped[variable] != unmapped) {
+      return mapped[variable] ^ (literal & 1);
+    }
+
+    // Leaves of the supergate rooted at this gate
+    std::vector<Literal> stack = {and_gate(variable).left,
+                                  and_gate(variable).right};
+    std::vector<Literal> leaves;
+
+    while (!stack.empty()) {
+      Literal child = stack.back();
+      stack.pop_back();
+      unsigned int child_variable = child >> 1;
+
+      if (!(child & 1) && is_and(child_variable) &&
+          fanout[child_variable - first_and_variable()] == 1) {
+        stack.push_back(and_gate(child_variable).left);
+        stack.push_back(and_gate(child_variable).right);
+      } else {
+        leaves.push_back(child);
+      }
+    }
+
+    using Entry = std::pair<std::size_t, Literal>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> shallowest;
+
+    for (Literal leaf : leaves) {
+      Literal rebuilt = rebuild(leaf);
+      shallowest.emplace(balanced.level(rebuilt), rebuilt);
+    }
+
+    while (shallowest.size() > 1) {
+      Literal first = shallowest.top().second;
+      shallowest.pop();
+      Literal second = shallowest.top().second;
+      shallowest.pop();
+      Literal conjunction = balanced.make_and(first, second);
+      shallowest.emplace(balanced.level(conjunction), conjunction);
+    }
+
+    mapped[variable] = shallowest.top().second;
+
+    return mapped[variable] ^ (literal & 1);
+  };
+
+  for (std::size_t i = 0; i < latches_.size(); ++i) {
+    balanced.set_latch_next(i, rebuild(latches_[i].next));
+  }
+
+  for (std::size_t i = 0; i < outputs_.size(); ++i) {
+    balanced.add_output(output_names_[i], rebuild(outputs_[i]));
+  }
+
+  return balanced;
+}
+
+std::size_t Aig::input_count() const {
+  return input_names_.size();
+}
+
+std::size_t Aig::latch_count() const {
+  return latches_.size();
+}
+
+std::size_t Aig::output_count() const {
+  return outputs_.size();
+}
+
+std::size_t Aig::and_count() const {
+  return and_gates_.size();
+}
+
+std::size_t Aig::depth() const {
+  std::size_t result = 0;
+
+  for (const Latch& latch : latches_) {
+    result = std::max(result, level(latch.next));
+  }
+
+  for (Literal output : outputs_) {
+    result = std::max(result, level(output));
+  }
+
+  return result;
+}
+
+void Aig::write_ascii(const std::string& filename) const {
+  std::ofstream out(filename);
+
+  if (!out) {
+    throw std::runtime_error("Error: Cannot open " + filename);
+  }
+
+  write_ascii(out);
+}
+
+void Aig::write_ascii(std::ostream& out) const {
+  out << "aag " << first_and_variable() - 1 + and_gates_.size() << " "
+      << input_names_.size() << " " << latches_.size() << " "
+      << outputs_.size() << " " << and_gates_.size() << "\n";
+
+  for (std::size_t i = 0; i < input_names_.size(); ++i) {
+    out << 2 * (i + 1) << "\n";
+  }
+
+  for (std::size_t i = 0; i < latches_.size(); ++i) {
+    out << 2 * (input_names_.size() + i + 1) << " " << latches_[i].next;
+
+    if (latches_[i].initial_value) {
+      out << " 1";
+    }
+
+    out << "\n";
+  }
+
+  for (Literal output : outputs_) {
+    out << output << "\n";
+  }
+
+  for (std::size_t i = 0; i < and_gates_.size(); ++i) {
+    out << 2 * (first_and_variable() + i) << " " << and_gates_[i].left << " "
+        << and_gates_[i].right << "\n";
+  }
+
+  for (std::size_t i = 0; i < input_names_.size(); ++i) {
+    out << "i" << i << " " << input_names_[i] << "\n";
+  }
+
+  for (std::size_t i = 0; i < latch_names_.size(); ++i) {
+    out << "l" << i << " " << latch_names_[i] << "\n";
+  }
+
+  for (std::size_t i = 0; i < output_names_.size(); ++i) {
+    out << "o" << i << " " << output_names_[i] << "\n";
+  }
+
+  out << "c\nBeSyft\n";
+}
+
+void Aig::write_binary(const std::string& filename) const {
+  std::ofstream out(filename, std::ios::binary);
+
+  if (!out) {
+    throw std::runtime_error("Error: Cannot open " + filename);
+  }
+
+  out << "aig " << first_and_variable() - 1 + and_gates_.size() << " "
+      << input_names_.size() << " " << latches_.size() << " "
+      << outputs_.size() << " " << and_gates_.size() << "\n";
+
+  // Inputs are implicit in the binary format
+  for (const Latch& latch : latches_) {
+    out << latch.next;
+
+    if (latch.initial_value) {
+      out << " 1";
+    }
+
+    out << "\n";
+  }
+
+  for (Literal output : outputs_) {
+    out << output << "\n";
+  }
+
+  // Gates are stored as deltas, which requires lhs > left >= right
+  for (std::size_t i = 0; i < and_gates_.size(); ++i) {
+    Literal lhs = 2 * (first_and_variable() + i);
+    write_unsigned(out, lhs - and_gates_[i].left);
+    write_unsigned(out, and_gates_[i].left - and_gates_[i].right);
+  }
+
+  for (std::size_t i = 0; i < input_names_.size(); ++i) {
+    out << "i" << i << " " << input_names_[i] << "\n";
+  }
+
+  for (std::size_t i = 0; i < latch_names_.size(); ++i) {
+    out << "l" << i << " " << latch_names_[i] << "\n";
+  }
+
+  for (std::size_t i = 0; i < output_names_.size(); ++i) {
+    out << "o" << i << " " << output_names_[i] << "\n";
+  }
+
+  out << "c\nBeSyft\n";
+}
+
+}
@@ -0,0 +1,416 @@
+#include "AntichainReachabilitySynthesizer.h"
+
+#include <iostream>
+
+#include "CancellationToken.h"
+
+namespace Syft {
+
+AntichainReachabilitySynthesizer::AntichainReachabilitySynthesizer(
+    ExplicitComponentProduct spec)
+    : Synthesizer<ExplicitComponentProduct>(std::move(spec)) {
+  includes_.resize(spec_.component_count());
+  representatives_.resize(spec_.component_count());
+  upward_closures_.resize(spec_.component_count());
+  predecessor_closures_.resize(spec_.component_count());
+
+  for (std::size_t c = 0; c < spec_.component_count(); ++c) {
+    compute_inclusion(c);
+  }
+}
+
+void AntichainReachabilitySynthesizer::compute_inclusion(std::size_t c) {
+  std::size_t state_count = spec_.component(c).state_count();
+  std::vector<boost::dynamic_bitset<>>& includes = includes_[c];
+
+  includes.assign(state_count, boost::dynamic_bitset<>(state_count));
+
+  for (std::size_t p = 0; p < state_count; ++p) {
+    for (std::size_t q = 0; q < state_count; ++q) {
+      includes[p][q] = !spec_.is_final(c, p) || spec_.is_final(c, q);
+    }
+  }
+
+  // Greatest fixpoint: a pair stays as long as every letter class leads to a
+  // pair that stays
+  bool changed = true;
+
+  while (changed) {
+    CancellationToken::global().check();
+    changed = false;
+
+    for (std::size_t p = 0; p < state_count; ++p) {
+      for (std::size_t q = includes[p].find_first();
+           q != boost::dynamic_bitset<>::npos;
+           q = includes[p].find_next(q)) {
+        bool included = true;
+
+        for (std::size_t outer = 0;
+             outer < spec_.outer_letter_count() && included; ++outer) {
+          for (std::size_t inner = 0;
+               inner < spec_.inner_letter_count() && included; ++inner) {
+            included = includes[spec_.successor(c, p, outer, inner)]
+                               [spec_.successor(c, q, outer, inner)];
+          }
+        }
+
+        if (!included) {
+          includes[p][q] = false;
+          changed = true;
+        }
+      }
+    }
+  }
+
+  representatives_[c].resize(state_count);
+
+  for (std::size_t q = 0; q < state_count; ++q) {
+    std::size_t p = 0;
+
+    while (!(includes[p][q] && includes[q][p])) {
+      ++p;
+    }
+
+    representatives_[c][q] = p;
+  }
+
+  // A_E has the opposite polarity: accepting less is better for the agent
+  bool accepting_more_is_better =
+      (c != ExplicitComponentProduct::environment_component);
+  upward_closures_[c].assign(state_count, boost::dynamic_bitset<>(state_count));
+
+  for (std::size_t p = 0; p < state_count; ++p) {
+    for (std::size_t q = 0; q < state_count; ++q) {
+      upward_closures_[c][q][p] =
+          accepting_more_is_better ? includes[q][p] : includes[p][q];
+    }
+  }
+}
+
+bool AntichainReachabilitySynthesizer::subsumes(const ProductState& better,
+                                                const ProductState& worse) const {
+  for (std::size_t c = 0; c < better.size(); ++c) {
+    if (!upward_closures_[c][worse[c]][better[c]]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool AntichainReachabilitySynthesizer::covered(
+    const std::vector<ProductState>& antichain,
+    const ProductState& state) const {
+  for (const ProductState& minimal : antichain) {
+    if (subsumes(state, minimal)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool AntichainReachabilitySynthesizer::insert(
+    std::vector<ProductState>& antichain,
+    const ProductState& state) const {
+  if (covered(antichain, state)) {
+    return false;
+  }
+
+  std::vector<ProductState> minimal;
+
+  for (const ProductState& tuple : antichain) {
+    if (!subsumes(tuple, state)) {
+      minimal.push_back(tuple);
+    }
+  }
+
+  minimal.push_back(state);
+  antichain.swap(minimal);
+
+  return true;
+}
+
+const boost::dynamic_bitset<>&
+AntichainReachabilitySynthesizer::predecessor_closure(std::size_t c,
+                                                      std::size_t state,
+                                                      std::size_t outer,
+                                                      std::size_t inner) const {
+  std::size_t letter_count =
+      spec_.outer_letter_count() * spec_.inner_letter_count();
+  std::size_t key = state * letter_count +
+      outer * spec_.inner_letter_count() + inner;
+  auto found = predecessor_closures_[c].find(key);
+
+  if (found != predecessor_closures_[c].end()) {
+    return found->second;
+  }
+
+  const boost::dynamic_bitset<>& closure = upward_closures_[c][state];
+  boost::dynamic_bitset<> predecessors(closure.size());
+
+  for (std::size_t q = closure.find_first();
+       q != boost::dynamic_bitset<>::npos;
+       q = closure.find_next(q)) {
+    for (std::size_t p : spec_.predecessors(c, q, outer, inner)) {
+      predecessors[p] = true;
+    }
+  }
+
+  return predecessor_closures_[c].emplace(key, std::move(predecessors))
+      .first->second;
+}
+
+std::vector<AntichainReachabilitySynthesizer::Box>
+AntichainReachabilitySynthesizer::predecessor_boxes(
+    const std::vector<ProductState>& antichain,
+    std::size_t outer,
+    std::size_t inner) const {
+  std::vector<Box> boxes;
+
+  for (const ProductState& tuple : antichain) {
+    Box box;
+    bool empty = false;
+
+    for (std::size_t c = 0; c < tuple.size() && !empty; ++c) {
+      box.push_back(predecessor_closure(c, tuple[c], outer, inner));
+      empty = box.back().none();
+    }
+
+    if (!empty) {
+      add_box(boxes, std::move(box));
+    }
+  }
+
+  return boxes;
+}
+
+void AntichainReachabilitySynthesizer::add_box(std::vector<Box>& boxes, Box box) {
+  auto contains = [] (const Box& larger, const Box& smaller) {
+    for (std::size_t c = 0; c < larger.size(); ++c) {
+      if (!smaller[c].is_subset_of(larger[c])) {
+        return false;
+      }
+    }
+
+    return true;
+  };
+
+  for (const Box& other : boxes) {
+    if (contains(other, box)) {
+      return;
+    }
+  }
+
+  std::vector<Box> maximal;
+
+  for (Box& other : boxes) {
+    if (!contains(box, other)) {
+      maximal.push_back(std::move(other));
+    }
+  }
+
+  maximal.push_back(std::move(box));
+  boxes.swap(maximal);
+}
+
+std::vector<AntichainReachabilitySynthesizer::Box>
+AntichainReachabilitySynthesizer::intersect(const std::vector<Box>& first,
+                                            const std::vector<Box>& second) {
+  std::vector<Box> result;
+
+  for (const Box& first_box : first) {
+    for (const Box& second_box : second) {
+      Box box(first_box.size());
+      bool empty = false;
+
+      for (std::size_t c = 0; c < box.size() && !empty; ++c) {
+        box[c] = first_box[c] & second_box[c];
+        empty = box[c].none();
+      }
+
+      if (!empty) {
+        add_box(result, std::move(box));
+      }
+    }
+  }
+
+  return result;
+}
+
+std::vector<AntichainReachabilitySynthesizer::ProductState>
+AntichainReachabilitySynthesizer::minimal_tuples(const Box& box) const {
+  std::vector<ProductState> tuples = {ProductState()};
+
+  for (std::size_t c = 0; c < box.size(); ++c) {
+    // Minimal representatives of the component set; another state below p
+    // is a state q != p whose upward closure contains p
+    std::vector<std::size_t> minimal;
+
+    for (std::size_t p = box[c].find_first();
+         p != boost::dynamic_bitset<>::npos;
+         p = box[c].find_next(p)) {
+      if (representatives_[c][p] != p) {
+        continue;
+      }
+
+      bool is_minimal = true;
+
+      for (std::size_t q = box[c].find_first();
+           q != boost::dynamic_bitset<>::npos && is_minimal;
+           q = box[c].find_next(q)) {
+        is_minimal = q == p || representatives_[c][q] != q ||
+            !upward_closures_[c][q][p];
+      }
+
+      if (is_minimal) {
+        minimal.push_back(p);
+      }
+    }
+
+    std::vector<ProductState> extended;
+
+    for (const ProductState& tuple : tuples) {
+      for (std::size_t state : minimal) {
+        extended.push_back(tuple);
+        extended.back().push_back(state);
+      }
+    }
+
+    tuples.swap(extended);
+  }
+
+  return tuples;
+}
+
+SynthesisResult AntichainReachabilitySynthesizer::run() const {
+  std::size_t agent = ExplicitComponentProduct::agent_component;
+  std::size_t environment = ExplicitComponentProduct::environment_component;
+  std::size_t tautology = ExplicitComponentProduct::tautology_component;
+
+  // The goal f_tt /\ (!f_E \/ f_phi) is the union of two upward-closed boxes
+  Box any_state;
+  Box final_states;
+
+  for (std::size_t c = 0; c < spec_.component_count(); ++c) {
+    std::size_t state_count = spec_.component(c).state_count();
+    any_state.push_back(boost::dynamic_bitset<>(state_count).set());
+    final_states.push_back(boost::dynamic_bitset<>(state_count));
+
+    for (std::size_t q = 0; q < state_count; ++q) {
+      final_states.back()[q] = spec_.is_final(c, q);
+    }
+  }
+
+  Box environment_rejects = any_state;
+  environment_rejects[environment] = ~final_states[environment];
+  environment_rejects[tautology] = final_states[tautology];
+
+  Box agent_accepts = any_state;
+  agent_accepts[agent] = final_states[agent];
+  agent_accepts[tautology] = final_states[tautology];
+
+  std::vector<ProductState> winning_antichain;
+
+  for (const Box& goal : {environment_rejects, agent_accepts}) {
+    for (const ProductState& tuple : minimal_tuples(goal)) {
+      insert(winning_antichain, tuple);
+    }
+  }
+
+  ProductState initial_state = spec_.initial_state();
+  winning_antichain_sizes_.clear();
+  std::size_t iteration = 0;
+  bool changed = true;
+
+  while (changed && !covered(winning_antichain, initial_state)) {
+    CancellationToken::global().check();
+    ++iteration;
+
+    // As in BitParallelReachabilitySynthesizer::controllable_word: the inner
+    // reduction is an intersection when the agent moves first, a union
+    // otherwise, and the outer reduction is the other one
+    std::vector<Box> controllable;
+
+    for (std::size_t outer = 0; outer < spec_.outer_letter_count(); ++outer) {
+      std::vector<Box> choice;
+
+      for (std::size_t inner = 0; inner < spec_.inner_letter_count(); ++inner) {
+        std::vector<Box> boxes =
+            predecessor_boxes(winning_antichain, outer, inner);
+
+        if (!spec_.outer_exists()) {
+          for (Box& box : boxes) {
+            add_box(choice, std::move(box));
+          }
+        } else if (inner == 0) {
+          choice.swap(boxes);
+        } else {
+          choice = intersect(choice, boxes);
+        }
+
+        if (spec_.outer_exists() && choice.empty()) {
+          break;
+        }
+      }
+
+      if (spec_.outer_exists()) {
+        for (Box& box : choice) {
+          add_box(controllable, std::move(box));
+        }
+      } else {
+        controllable = (outer == 0) ? choice : intersect(controllable, choice);
+
+        if (controllable.empty()) {
+          break;
+        }
+      }
+    }
+
+    changed = false;
+
+    for (const Box& box : controllable) {
+      for (const ProductState& tuple : minimal_tuples(box)) {
+        changed = insert(winning_antichain, tuple) || changed;
+      }
+    }
+
+    winning_antichain_sizes_.push_back(winning_antichain.size());
+
+    std::cout << "[BeSyft] Antichain iteration " << iteration << ": "
+              << winning_antichain.size() << " minimal winning tuples"
+              << std::endl;
+  }
+
+  CUDD::BDD winning_states = spec_.product_states_to_bdd({});
+
+  for (const ProductState& tuple : winning_antichain) {
+    std::vector<std::vector<std::size_t>> closure(tuple.size());
+
+    for (std::size_t c = 0; c < tuple.size(); ++c) {
+      const boost::dynamic_bitset<>& states = upward_closures_[c][tuple[c]];
+
+      for (std::size_t q = states.find_first();
+           q != boost::dynamic_bitset<>::npos;
+           q = states.find_next(q)) {
+        closure[c].push_back(q);
+      }
+    }
+
+    winning_states |= spec_.component_sets_to_bdd(closure);
+  }
+
+  SynthesisResult result;
+  result.realizability = covered(winning_antichain, initial_state);
+  result.winning_states = winning_states;
+  result.transducer = nullptr;
+
+  return result;
+}
+
+std::vector<std::size_t>
+AntichainReachabilitySynthesizer::winning_antichain_sizes() const {
+  return winning_antichain_sizes_;
+}
+
+}
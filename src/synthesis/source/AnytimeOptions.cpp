@@ -0,0 +1,32 @@
+#include "AnytimeOptions.h"
+
+namespace Syft {
+
+void AnytimeOptions::report(BestEffortPhase phase,
+                            const SynthesisResult& result,
+                            double running_time) const {
+  if (on_phase) {
+    on_phase(phase, result, running_time);
+  }
+}
+
+SynthesisResult AnytimeOptions::cooperative_from_adversarial(
+    const SynthesisResult& adversarial_result) {
+  SynthesisResult result;
+  // An adversarially winning state is also cooperatively winning
+  result.realizability = adversarial_result.realizability;
+  result.winning_states = adversarial_result.winning_states;
+
+  if (adversarial_result.transducer) {
+    result.transducer = std::make_unique<Transducer>(*adversarial_result.transducer);
+  }
+
+  if (adversarial_result.strategy_oracle) {
+    result.strategy_oracle =
+        std::make_unique<LazyStrategyOracle>(*adversarial_result.strategy_oracle);
+  }
+
+  return result;
+}
+
+}
@@ -0,0 +1,45 @@
+#include "BestEffortTransducer.h"
+
+#include <stdexcept>
+
+namespace Syft {
+
+BestEffortTransducer::BestEffortTransducer(
+    const SynthesisResult& adversarial_result,
+    const SynthesisResult& cooperative_result)
+    : Transducer(*adversarial_result.transducer)
+    , adversarial_winning_states_(adversarial_result.winning_states)
+    , cooperative_winning_states_(cooperative_result.winning_states) {
+  const Transducer& cooperative = *cooperative_result.transducer;
+
+  if (cooperative.output_indices() != output_indices_) {
+    throw std::runtime_error(
+        "Error: Adversarial and cooperative transducers have different outputs.");
+  }
+
+  // Adversarial output in adversarially winning states, cooperative output in
+  // cooperatively only winning states, 0 elsewhere
+  for (std::size_t i = 0; i < output_function_.size(); ++i) {
+    output_function_[i] = adversarial_winning_states_.Ite(
+        output_function_[i],
+        cooperative_winning_states_ & cooperative.output_functions()[i]);
+  }
+}
+
+void BestEffortTransducer::minimize(DontCareMinimization method) {
+  minimize(winning_states(), method);
+}
+
+CUDD::BDD BestEffortTransducer::winning_states() const {
+  return adversarial_winning_states_ | cooperative_winning_states_;
+}
+
+CUDD::BDD BestEffortTransducer::adversarial_winning_states() const {
+  return adversarial_winning_states_;
+}
+
+CUDD::BDD BestEffortTransducer::cooperative_only_winning_states() const {
+  return (!adversarial_winning_states_) & cooperative_winning_states_;
+}
+
+}
@@ -0,0 +1,258 @@
+#include "BitParallelReachabilitySynthesizer.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "CancellationToken.h"
+#include "SymbolicStateDfa.h"
+
+namespace Syft {
+
+namespace {
+
+constexpr std::size_t word_bits =
+    std::numeric_limits<BitParallelReachabilitySynthesizer::Word>::digits;
+
+inline BitParallelReachabilitySynthesizer::Word test_bit(
+    const std::vector<BitParallelReachabilitySynthesizer::Word>& words,
+    std::size_t i) {
+  return (words[i / word_bits] >> (i % word_bits)) & 1;
+}
+
+inline void set_bit(
+    std::vector<BitParallelReachabilitySynthesizer::Word>& words,
+    std::size_t i) {
+  words[i / word_bits] |=
+      BitParallelReachabilitySynthesizer::Word(1) << (i % word_bits);
+}
+
+}
+
+BitParallelReachabilitySynthesizer::BitParallelReachabilitySynthesizer(
+    ExplicitStateDfa spec,
+    Player starting_player,
+    Player protagonist_player,
+    std::vector<std::size_t> goal_states)
+    : Synthesizer<ExplicitStateDfa>(spec)
+    , starting_player_(starting_player)
+    , protagonist_player_(protagonist_player)
+    , goal_states_(std::move(goal_states)) {
+  var_mgr_ = spec_.var_mgr();
+
+  LetterClasses letter_classes(var_mgr_, {spec_});
+
+  // The player moving first picks the outer class of a letter, the other
+  // player the inner class. Each player quantifies existentially if it is the
+  // protagonist and universally otherwise.
+  const LetterPartition* outer_partition =
+      &letter_classes.first_mover_partition(starting_player_);
+  const LetterPartition* inner_partition =
+      &letter_classes.second_mover_partition(starting_player_);
+
+  outer_exists_ = (starting_player_ == protagonist_player_);
+  inner_exists_ = !outer_exists_;
+
+  outer_letter_count_ = outer_partition->class_count();
+  inner_letter_count_ = inner_partition->class_count();
+
+  std::size_t state_count = spec_.state_count();
+  std::size_t max_entries = max_table_bytes / (2 * sizeof(std::uint32_t));
+
+  // Divisions instead of products, which could overflow
+  if (outer_letter_count_ > max_entries / inner_letter_count_ ||
+      outer_letter_count_ * inner_letter_count_ >
+          max_entries / std::max<std::size_t>(state_count, 1)) {
+    throw std::runtime_error(
+        "Error: Predecessor table too large for the bit-parallel explicit solver.");
+  }
+
+  std::size_t letter_count = outer_letter_count_ * inner_letter_count_;
+  std::vector<CUDD::ADD> transition_function = spec_.transition_function();
+
+  std::vector<std::uint32_t> successor_table(letter_count * state_count);
+
+  // Representatives of input and output classes valuate disjoint variables,
+  // so their sum is a representative of the combined letter
+  std::vector<int> letter(var_mgr_->total_variable_count());
+
+  for (std::size_t outer = 0; outer < outer_letter_count_; ++outer) {
+    const std::vector<int>& outer_representative =
+        outer_partition->representatives[outer];
+
+    for (std::size_t inner = 0; inner < inner_letter_count_; ++inner) {
+      const std::vector<int>& inner_representative =
+          inner_partition->representatives[inner];
+
+      for (std::size_t i = 0; i < letter.size(); ++i) {
+        letter[i] = outer_representative[i] + inner_representative[i];
+      }
+
+      std::size_t column = outer * inner_letter_count_ + inner;
+
+      for (std::size_t state = 0; state < state_count; ++state) {
+        successor_table[column * state_count + state] =
+            static_cast<std::uint32_t>(
+                LetterClasses::successor(transition_function[state], letter));
+      }
+    }
+  }
+
+  // Inverted by counting sort, one bucket per letter class and successor
+  predecessor_offsets_.assign(letter_count * state_count + 1, 0);
+  predecessor_states_.resize(letter_count * state_count);
+
+  for (std::size_t column = 0; column < letter_count; ++column) {
+    for (std::size_t state = 0; state < state_count; ++state) {
+      std::size_t successor = successor_table[column * state_count + state];
+      ++predecessor_offsets_[column * state_count + successor + 1];
+    }
+  }
+
+  for (std::size_t i = 1; i < predecessor_offsets_.size(); ++i) {
+    predecessor_offsets_[i] += predecessor_offsets_[i - 1];
+  }
+
+  std::vector<std::uint32_t> next(predecessor_offsets_.begin(),
+                                  predecessor_offsets_.end() - 1);
+
+  for (std::size_t column = 0; column < letter_count; ++column) {
+    for (std::size_t state = 0; state < state_count; ++state) {
+      std::size_t successor = successor_table[column * state_count + state];
+      predecessor_states_[next[column * state_count + successor]++] =
+          static_cast<std::uint32_t>(state);
+    }
+  }
+
+  // Created once, so that solving again does not add variables to the manager
+  std::shared_ptr<VarMgr> var_mgr = var_mgr_;
+  winning_state_automaton_id_ =
+      SymbolicStateDfa::create_state_variables(var_mgr, state_count).second;
+}
+
+BitParallelReachabilitySynthesizer::Word
+BitParallelReachabilitySynthesizer::controllable_word(
+    const std::vector<Word>& letter_words,
+    std::size_t word_count,
+    std::size_t word) const {
+  const Word all_states = ~Word(0);
+  Word result = outer_exists_ ? 0 : all_states;
+
+  for (std::size_t outer = 0; outer < outer_letter_count_; ++outer) {
+    // The inner letters of an outer class are contiguous
+    const Word* cell =
+        &letter_words[outer * inner_letter_count_ * word_count + word];
+    Word accumulator = inner_exists_ ? 0 : all_states;
+
+    for (std::size_t inner = 0; inner < inner_letter_count_; ++inner) {
+      accumulator = inner_exists_ ? (accumulator | cell[inner * word_count])
+                                  : (accumulator & cell[inner * word_count]);
+    }
+
+    result = outer_exists_ ? (result | accumulator) : (result & accumulator);
+  }
+
+  return result;
+}
+
+boost::dynamic_bitset<> BitParallelReachabilitySynthesizer::winning_region(
+    bool stop_at_initial) const {
+  std::size_t state_count = spec_.state_count();
+  std::size_t word_count = (state_count + word_bits - 1) / word_bits;
+  std::size_t letter_count = outer_letter_count_ * inner_letter_count_;
+  std::size_t initial_state = spec_.initial_state();
+
+  std::vector<Word> winning_words(word_count, 0);
+  // letter_words[l * word_count + w] holds the states of word w whose
+  // successor on letter class l is winning
+  std::vector<Word> letter_words(letter_count * word_count, 0);
+  std::vector<std::size_t> frontier;
+
+  for (std::size_t goal_state : goal_states_) {
+    if (!test_bit(winning_words, goal_state)) {
+      set_bit(winning_words, goal_state);
+      frontier.push_back(goal_state);
+    }
+  }
+
+  std::vector<bool> touched(word_count, false);
+  std::vector<std::size_t> touched_words;
+
+  while (!frontier.empty()) {
+    CancellationToken::global().check();
+
+    if (stop_at_initial && test_bit(winning_words, initial_state)) {
+      break;
+    }
+
+    // Only the words holding a predecessor of a new winner can change
+    for (std::size_t state : frontier) {
+      for (std::size_t letter = 0; letter < letter_count; ++letter) {
+        std::size_t bucket = letter * state_count + state;
+
+        for (std::size_t i = predecessor_offsets_[bucket];
+             i < predecessor_offsets_[bucket + 1]; ++i) {
+          std::size_t predecessor = predecessor_states_[i];
+          std::size_t word = predecessor / word_bits;
+          letter_words[letter * word_count + word] |=
+              Word(1) << (predecessor % word_bits);
+
+          if (!touched[word]) {
+            touched[word] = true;
+            touched_words.push_back(word);
+          }
+        }
+      }
+    }
+
+    // All touched words are reduced against the previous iteration
+    frontier.clear();
+
+    for (std::size_t word : touched_words) {
+      touched[word] = false;
+      Word added = controllable_word(letter_words, word_count, word) &
+          ~winning_words[word];
+
+      for (std::size_t bit = 0; added != 0; ++bit, added >>= 1) {
+        if (added & 1) {
+          frontier.push_back(word * word_bits + bit);
+        }
+      }
+    }
+
+    touched_words.clear();
+
+    for (std::size_t state : frontier) {
+      set_bit(winning_words, state);
+    }
+  }
+
+  boost::dynamic_bitset<> winning_states(winning_words.begin(),
+                                         winning_words.end());
+  winning_states.resize(state_count);
+
+  return winning_states;
+}
+
+SynthesisResult BitParallelReachabilitySynthesizer::run() const {
+  SynthesisResult result;
+  boost::dynamic_bitset<> winning_states = winning_region(true);
+
+  result.realizability = winning_states[spec_.initial_state()];
+
+  std::vector<std::size_t> winning_state_list;
+
+  for (std::size_t state = winning_states.find_first();
+       state != boost::dynamic_bitset<>::npos;
+       state = winning_states.find_next(state)) {
+    winning_state_list.push_back(state);
+  }
+
+  result.winning_states = SymbolicStateDfa::state_set_to_bdd(
+      var_mgr_, winning_state_automaton_id_, winning_state_list);
+  result.transducer = nullptr;
+
+  return result;
+}
+
+}
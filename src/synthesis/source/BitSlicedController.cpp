@@ -0,0 +1,246 @@
+#include "BitSlicedController.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace Syft {
+
+namespace {
+
+constexpr std::uint64_t all_ones = ~std::uint64_t(0);
+
+}
+
+BitSlicedController::BitSlicedController(const Transducer& transducer) {
+  std::shared_ptr<VarMgr> var_mgr = transducer.var_mgr_;
+  std::unordered_map<DdNode*, std::uint32_t> positions;
+
+  network_.push_back({std::numeric_limits<std::uint32_t>::max(), 0, 0, 0, 0});
+
+  // Output functions are compiled first. They do not depend on outputs, so
+  // their multiplexers can be evaluated before the outputs are known.
+  for (std::size_t i = 0; i < transducer.output_indices_.size(); ++i) {
+    output_indices_.push_back(transducer.output_indices_[i]);
+    output_roots_.push_back(
+        compile(transducer.output_function_[i].getNode(), positions));
+  }
+
+  output_network_end_ = network_.size();
+
+  for (const CUDD::BDD& bit_function : transducer.transition_function_) {
+    transition_roots_.push_back(compile(bit_function.getNode(), positions));
+  }
+
+  for (const std::string& label : transducer.input_labels()) {
+    input_indices_.push_back(var_mgr->name_to_variable(label).NodeReadIndex());
+  }
+
+  for (std::size_t i = 0;
+       i < var_mgr->state_variable_count(transducer.automaton_id_); ++i) {
+    std::uint32_t index =
+        var_mgr->state_variable(transducer.automaton_id_, i).NodeReadIndex();
+    state_indices_.push_back(index);
+    initial_state_.push_back(transducer.initial_vector_[index] ? 1 : 0);
+  }
+
+  Slice zero;
+  std::fill(std::begin(zero.words), std::end(zero.words), 0);
+  Slice one;
+  std::fill(std::begin(one.words), std::end(one.words), all_ones);
+
+  valuation_.assign(var_mgr->total_variable_count(), zero);
+  values_.assign(network_.size(), zero);
+  values_[0] = one;
+  next_state_.assign(state_indices_.size(), zero);
+  reset();
+}
+
+std::uint32_t BitSlicedController::compile(
+    DdNode* node, std::unordered_map<DdNode*, std::uint32_t>& positions) {
+  std::uint32_t complement = Cudd_IsComplement(node) ? 1 : 0;
+  DdNode* regular = Cudd_Regular(node);
+
+  if (Cudd_IsConstant(regular)) {
+    return complement;
+  }
+
+  auto found = positions.find(regular);
+
+  if (found != positions.end()) {
+    return (found->second << 1) | complement;
+  }
+
+  std::uint32_t then_edge = compile(Cudd_T(regular), positions);
+  std::uint32_t else_edge = compile(Cudd_E(regular), positions);
+  std::uint32_t position = network_.size();
+
+  network_.push_back({Cudd_NodeReadIndex(regular),
+                      then_edge >> 1,
+                      else_edge >> 1,
+                      (then_edge & 1) ? all_ones : 0,
+                      (else_edge & 1) ? all_ones : 0});
+  positions.emplace(regular, position);
+
+  return (position << 1) | complement;
+}
+
+void BitSlicedController::evaluate(std::size_t begin, std::size_t end) {
+  for (std::size_t i = begin; i < end; ++i) {
+    const Mux& mux = network_[i];
+    const Slice& selector = valuation_[mux.variable];
+    const Slice& then_value = values_[mux.then_operand];
+    const Slice& else_value = values_[mux.else_operand];
+    Slice& result = values_[i];
+
+#if defined(__AVX2__)
+    __m256i s = _mm256_load_si256(reinterpret_cast<const __m256i*>(selector.words));
+    __m256i t = _mm256_xor_si256(
+        _mm256_load_si256(reinterpret_cast<const __m256i*>(then_value.words)),
+        _mm256_set1_epi64x(static_cast<long long>(mux.then_mask)));
+    __m256i e = _mm256_xor_si256(
+        _mm256_load_si256(reinterpret_cast<const __m256i*>(else_value.words)),
+        _mm256_set1_epi64x(static_cast<long long>(mux.else_mask)));
+    _mm256_store_si256(reinterpret_cast<__m256i*>(result.words),
+                       _mm256_or_si256(_mm256_and_si256(s, t),
+                                       _mm256_andnot_si256(s, e)));
+#else
+    for (std::size_t w = 0; w < slice_words; ++w) {
+      std::uint64_t s = selector.words[w];
+      result.words[w] = (s & (then_value.words[w] ^ mux.then_mask)) |
+          (~s & (else_value.words[w] ^ mux.else_mask));
+    }
+#endif
+  }
+}
+
+BitSlicedController::Slice BitSlicedController::root_value(
+    std::uint32_t root) const {
+  Slice value = values_[root >> 1];
+  std::uint64_t mask = (root & 1) ? all_ones : 0;
+
+  for (std::size_t w = 0; w < slice_words; ++w) {
+    value.words[w] ^= mask;
+  }
+
+  return value;
+}
+
+void BitSlicedController::reset() {
+  for (std::size_t i = 0; i < state_indices_.size(); ++i) {
+    std::uint64_t word = initial_state_[i] ? all_ones : 0;
+    std::fill(std::begin(valuation_[state_indices_[i]].words),
+              std::end(valuation_[state_indices_[i]].words), word);
+  }
+}
+
+void BitSlicedController::step(const Slice* inputs, Slice* outputs) {
+  for (std::size_t i = 0; i < input_indices_.size(); ++i) {
+    valuation_[input_indices_[i]] = inputs[i];
+  }
+
+  evaluate(1, output_network_end_);
+
+  for (std::size_t i = 0; i < output_roots_.size(); ++i) {
+    outputs[i] = root_value(output_roots_[i]);
+    valuation_[output_indices_[i]] = outputs[i];
+  }
+
+  evaluate(output_network_end_, network_.size());
+
+  for (std::size_t i = 0; i < transition_roots_.size(); ++i) {
+    next_state_[i] = root_value(transition_roots_[i]);
+  }
+
+  for (std::size_t i = 0; i < state_indices_.size(); ++i) {
+    valuation_[state_indices_[i]] = next_state_[i];
+  }
+}
+
+std::vector<std::vector<std::uint8_t>> BitSlicedController::run_batch(
+    const std::vector<std::vector<std::uint8_t>>& traces) {
+  std::size_t input_count = input_indices_.size();
+  std::size_t output_count = output_indices_.size();
+  std::vector<std::vector<std::uint8_t>> outputs(traces.size());
+  std::vector<Slice> input_slices(input_count);
+  std::vector<Slice> output_slices(output_count);
+
+  if (input_count == 0) {
+    throw std::runtime_error("Error: Traces cannot be delimited without inputs.");
+  }
+
+  for (const std::vector<std::uint8_t>& trace : traces) {
+    if (trace.size() % input_count != 0) {
+      throw std::invalid_argument(
+          "Error: Trace length is not a multiple of the number of inputs.");
+    }
+  }
+
+  for (std::size_t first = 0; first < traces.size(); first += lane_count) {
+    std::size_t lanes = std::min(lane_count, traces.size() - first);
+    std::size_t length = 0;
+
+    for (std::size_t l = 0; l < lanes; ++l) {
+      length = std::max(length, traces[first + l].size() / input_count);
+      outputs[first + l].resize(traces[first + l].size() / input_count *
+                                output_count);
+    }
+
+    reset();
+
+    for (std::size_t t = 0; t < length; ++t) {
+      for (Slice& slice : input_slices) {
+        std::fill(std::begin(slice.words), std::end(slice.words), 0);
+      }
+
+      // Lanes whose trace has ended read 0s and their outputs are dropped
+      for (std::size_t l = 0; l < lanes; ++l) {
+        const std::vector<std::uint8_t>& trace = traces[first + l];
+
+        if ((t + 1) * input_count > trace.size()) {
+          continue;
+        }
+
+        for (std::size_t i = 0; i < input_count; ++i) {
+          input_slices[i].words[l / 64] |=
+              std::uint64_t(trace[t * input_count + i] & 1) << (l % 64);
+        }
+      }
+
+      step(input_slices.data(), output_slices.data());
+
+      for (std::size_t l = 0; l < lanes; ++l) {
+        std::vector<std::uint8_t>& output = outputs[first + l];
+
+        if ((t + 1) * output_count > output.size()) {
+          continue;
+        }
+
+        for (std::size_t i = 0; i < output_count; ++i) {
+          output[t * output_count + i] =
+              (output_slices[i].words[l / 64] >> (l % 64)) & 1;
+        }
+      }
+    }
+  }
+
+  return outputs;
+}
+
+std::size_t BitSlicedController::input_count() const {
+  return input_indices_.size();
+}
+
+std::size_t BitSlicedController::output_count() const {
+  return output_indices_.size();
+}
+
+std::size_t BitSlicedController::mux_count() const {
+  return network_.size() - 1;
+}
+
+}
@@ -0,0 +1,87 @@
+#include "CancellationToken.h"
+
+namespace Syft {
+
+SynthesisTimeout::SynthesisTimeout()
+    : std::runtime_error("Synthesis timed out")
+    , running_times_(RunningTimesScope::running_times()) {}
+
+const std::vector<double>& SynthesisTimeout::running_times() const {
+  return running_times_;
+}
+
+std::vector<const std::vector<double>*>& RunningTimesScope::open_scopes() {
+  static std::vector<const std::vector<double>*> scopes;
+  return scopes;
+}
+
+RunningTimesScope::RunningTimesScope(const std::vector<double>& running_times) {
+  open_scopes().push_back(&running_times);
+}
+
+RunningTimesScope::~RunningTimesScope() {
+  open_scopes().pop_back();
+}
+
+std::vector<double> RunningTimesScope::running_times() {
+  std::vector<double> running_times;
+
+  for (const std::vector<double>* scope : open_scopes()) {
+    running_times.insert(running_times.end(), scope->begin(), scope->end());
+  }
+
+  return running_times;
+}
+
+CancellationToken::CancellationToken()
+    : cancelled_(false)
+    , has_deadline_(false)
+    , poll_count_(0) {}
+
+CancellationToken& CancellationToken::global() {
+  static CancellationToken token;
+  return token;
+}
+
+void CancellationToken::cancel() {
+  cancelled_.store(true);
+}
+
+void CancellationToken::set_deadline(double seconds) {
+  deadline_ = std::chrono::steady_clock::now() +
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>(seconds));
+  has_deadline_ = true;
+}
+
+void CancellationToken::clear_deadline() {
+  has_deadline_ = false;
+}
+
+bool CancellationToken::cancelled() const {
+  if (cancelled_.load()) {
+    return true;
+  }
+
+  return has_deadline_ && std::chrono::steady_clock::now() >= deadline_;
+}
+
+bool CancellationToken::poll() {
+  if (cancelled_.load()) {
+    return true;
+  }
+
+  return ++poll_count_ % poll_interval == 0 && cancelled();
+}
+
+bool CancellationToken::cancel_requested() const {
+  return cancelled_.load();
+}
+
+void CancellationToken::check() const {
+  if (cancelled()) {
+    throw SynthesisTimeout();
+  }
+}
+
+}
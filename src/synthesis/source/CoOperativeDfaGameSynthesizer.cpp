@@ -5,16 +5,17 @@
 *
 */
 #include"CoOperativeDfaGameSynthesizer.h"
-#include<cassert>
 
 namespace Syft {
 
     CoOperativeDfaGameSynthesizer::CoOperativeDfaGameSynthesizer(SymbolicStateDfa spec,
                                                                 Player starting_player,
-                                                                Player protagonist_player): 
+                                                                Player protagonist_player,
+                                                                StrategyExtractionOptions extraction_options): 
                 Synthesizer<SymbolicStateDfa>(spec),
                 starting_player_(starting_player),
-                protagonist_player_(protagonist_player) {
+                protagonist_player_(protagonist_player),
+                extraction_options_(extraction_options) {
         var_mgr_ = spec.var_mgr(); // i.e. extract variabiles from SDFA
 
         // Construct initial state and transition function of SDFA
@@ -71,59 +72,8 @@ namespace Syft {
         return winning_states.Eval(copy.data()).IsOne();
     }
 
-    std::unordered_map<int, CUDD::BDD> CoOperativeDfaGameSynthesizer::synthesize_strategy(
-        const CUDD::BDD &winning_moves) const {
-std::vector<CUDD::BDD> parameterized_output_function;
-  int* output_indices;
-  CUDD::BDD output_cube = var_mgr_->output_cube();
-  std::size_t output_count = var_mgr_->output_variable_count();
-
-  // Need to negate the BDD because b.SolveEqn(...) solves the equation b = 0
-  CUDD::BDD pre = (!winning_moves).SolveEqn(output_cube,
-					    parameterized_output_function,
-					    &output_indices,
-					    output_count);
-
-  // Copy the index since it will be necessary in the last step
-  std::vector<int> index_copy(output_count);
-
-  for (std::size_t i = 0; i < output_count; ++i) {
-    index_copy[i] = output_indices[i];
-  }
-
-  // Verify that the solution is correct, also frees output_index
-  CUDD::BDD verified = (!winning_moves).VerifySol(parameterized_output_function,
-						  output_indices);
-
-  assert(pre == verified);
-
-  std::unordered_map<int, CUDD::BDD> output_function;
-  
-  // Let y_i be the i-th output variable in the BDD ordering. The parameterized
-  // output function for y_i is of the form f_i(x_1, ..., x_m, p_i, ..., p_n)
-  // where p_i, ..., p_n are parameters taking the place of y_i, ..., y_n. All
-  // f_i are such that no matter what we replace p_i, ..., p_n with, the result
-  // is a valid output function. We replace the parameters with 1 so that all
-  // f_i are dependent only on the input and state variables.
-  for (int i = output_count - 1; i >= 0; --i) {
-      int output_index = index_copy[i];
-
-      output_function[output_index] = parameterized_output_function[i];
-
-      // TODO(Lucas): Replace inner loop with CUDD::BDD::VectorCompose
-      for (int j = output_count - 1; j >= i; --j) {
-          int parameter_index = index_copy[j];
-
-	  // Can be anything, set to the constant 1 for simplicity
-	  CUDD::BDD parameter_value = var_mgr_->cudd_mgr()->bddOne();
-
-	  output_function[output_index] =
-	    output_function[output_index].Compose(parameter_value,
-						  parameter_index);
-      }
-  }
-
-  return output_function;
-
+    void CoOperativeDfaGameSynthesizer::attach_strategy(SynthesisResult &result, const CUDD::BDD &winning_moves) const {
+            StrategyExtractor extractor(var_mgr_, protagonist_player_, extraction_options_);
+            extractor.attach_strategy(result, spec_, starting_player_, winning_moves);
+        }
 }
-}
\ No newline at end of file
@@ -0,0 +1,105 @@
+/*
+* This file defines the class ComponentAdversarialSynthesizer
+* which implements reactive synthesis under environment assumptions
+* by solving the game over the product of the component DFAs
+* without building the product
+*/
+
+#include "ComponentAdversarialSynthesizer.h"
+#include "CancellationToken.h"
+
+namespace Syft {
+
+    ComponentAdversarialSynthesizer::ComponentAdversarialSynthesizer(
+                            std::shared_ptr<VarMgr> var_mgr,
+                            std::string agent_specification,
+                            std::string environment_specification,
+                            InputOutputPartition partition,
+                            Player starting_player,
+                            ComponentGameSolver solver) :   
+                                var_mgr_(var_mgr),
+                                agent_specification_(agent_specification),
+                                environment_specification_(environment_specification),
+                                partition_(partition),
+                                starting_player_(starting_player),
+                                solver_(solver)
+    {
+        RunningTimesScope running_times_scope(running_times_);
+
+        // step 1. Construct MONA DFAs of the components phi, E and tt
+        Stopwatch ltlf2dfa;
+        ltlf2dfa.start();
+
+        ExplicitStateDfaMona agent_spec_dfa =
+            ExplicitStateDfaMona::dfa_of_formula(agent_specification_); // DFA A_{phi}
+        ExplicitStateDfaMona environment_spec_dfa =
+            ExplicitStateDfaMona::dfa_of_formula(environment_specification_); // DFA A_{E}
+        ExplicitStateDfaMona tautology_dfa =
+            ExplicitStateDfaMona::dfa_of_formula("true"); // DFA A_{tt}. Accepts non-empty traces only
+
+        double t_ltlf2dfa = ltlf2dfa.stop().count() / 1000.0;
+        running_times_.push_back(t_ltlf2dfa);
+        std::cout << "[BeSyft] MONA DFA construction DONE in: " << t_ltlf2dfa << " s" << std::endl;
+
+        Syft::Stopwatch dfa2explicit;
+        dfa2explicit.start();
+
+        std::string adversarial_formula = 
+            "(" + environment_specification_ + ") -> (" + agent_specification_ + ")";
+
+        formula parsed_adversarial_formula = 
+            parse_formula(adversarial_formula.c_str()); // parses (E -> phi)
+
+        // Extract propositions from formula and partition
+        var_mgr_->create_named_variables(get_props(parsed_adversarial_formula)); // (E -> phi) includes all problem variables
+        var_mgr_->partition_variables(partition_.input_variables,
+                                        partition_.output_variables);
+
+        // The components are kept separate: their product is explored on the fly
+        explicit_dfas_.push_back(ExplicitStateDfa::from_dfa_mona(var_mgr_, agent_spec_dfa));
+        explicit_dfas_.push_back(ExplicitStateDfa::from_dfa_mona(var_mgr_, environment_spec_dfa));
+        explicit_dfas_.push_back(ExplicitStateDfa::from_dfa_mona(var_mgr_, tautology_dfa));
+
+        double t_dfa2explicit = dfa2explicit.stop().count() / 1000.0;
+        std::cout << "[BeSyft] Explicit-state DFA construction DONE in " << t_dfa2explicit << std::endl;
+        running_times_.push_back(t_dfa2explicit);
+    }                        
+
+    SynthesisResult ComponentAdversarialSynthesizer::run() 
+    {
+        RunningTimesScope running_times_scope(running_times_);
+
+        SynthesisResult adv_result;
+
+        // Step 2. Decide the adversarial game over A_phi x A_E x A_tt
+        Stopwatch advGame;
+        advGame.start();
+        ExplicitComponentProduct product(var_mgr_,
+                                         explicit_dfas_[0],
+                                         explicit_dfas_[1],
+                                         explicit_dfas_[2],
+                                         starting_player_);
+        if (solver_ == ComponentGameSolver::Antichain) {
+            std::cout << "[BeSyft] Constructing and solving antichain adversarial game...";
+            AntichainReachabilitySynthesizer adv_synthesizer(product);
+            adv_result = adv_synthesizer.run();
+            double t_advGame = advGame.stop().count() / 1000.0;
+            running_times_.push_back(t_advGame);
+            std::cout << "[BeSyft] Antichain adversarial game DONE in " << t_advGame << " s" << std::endl;
+        } else {
+            std::cout << "[BeSyft] Constructing and solving on-the-fly adversarial game...";
+            OnTheFlyReachabilitySynthesizer adv_synthesizer(product);
+            adv_result = adv_synthesizer.run();
+            double t_advGame = advGame.stop().count() / 1000.0;
+            running_times_.push_back(t_advGame);
+            std::cout << "DONE in " << t_advGame << " s" << std::endl;
+            std::cout << "[BeSyft] Expanded " << adv_synthesizer.expanded_state_count()
+                      << " of " << product.product_state_count() << " product states" << std::endl;
+        }
+        return adv_result;
+    }
+
+    std::vector<double> ComponentAdversarialSynthesizer::get_running_times() const {
+        return running_times_;
+    }                                      
+}
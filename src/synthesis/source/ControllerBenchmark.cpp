@@ -0,0 +1,116 @@
+#include "ControllerBenchmark.h"
+
+#include <random>
+#include <stdexcept>
+
+#include "BitSlicedController.h"
+#include "Stopwatch.h"
+#include "TransducerExecutor.h"
+
+namespace Syft {
+
+ControllerBenchmark::ControllerBenchmark(const Transducer& transducer)
+    : transducer_(transducer)
+{}
+
+std::vector<std::vector<std::uint8_t>> ControllerBenchmark::run_eval(
+    const std::vector<std::vector<std::uint8_t>>& traces) const {
+  std::shared_ptr<VarMgr> var_mgr = transducer_.var_mgr_;
+  std::size_t automaton_id = transducer_.automaton_id_;
+  std::vector<int> input_indices;
+  std::vector<int> state_indices;
+
+  for (const std::string& label : transducer_.input_labels()) {
+    input_indices.push_back(var_mgr->name_to_variable(label).NodeReadIndex());
+  }
+
+  for (std::size_t i = 0; i < var_mgr->state_variable_count(automaton_id); ++i) {
+    state_indices.push_back(
+        var_mgr->state_variable(automaton_id, i).NodeReadIndex());
+  }
+
+  std::size_t input_count = input_indices.size();
+  std::size_t output_count = transducer_.output_indices_.size();
+  std::vector<std::vector<std::uint8_t>> outputs;
+  std::vector<int> next_state(state_indices.size());
+
+  for (const std::vector<std::uint8_t>& trace : traces) {
+    std::vector<int> valuation(transducer_.initial_vector_);
+    std::size_t length = trace.size() / input_count;
+    outputs.emplace_back(length * output_count);
+
+    for (std::size_t t = 0; t < length; ++t) {
+      for (std::size_t i = 0; i < input_count; ++i) {
+        valuation[input_indices[i]] = trace[t * input_count + i];
+      }
+
+      for (std::size_t i = 0; i < output_count; ++i) {
+        int value =
+            transducer_.output_function_[i].Eval(valuation.data()).IsOne();
+        valuation[transducer_.output_indices_[i]] = value;
+        outputs.back()[t * output_count + i] = value;
+      }
+
+      for (std::size_t i = 0; i < state_indices.size(); ++i) {
+        next_state[i] =
+            transducer_.transition_function_[i].Eval(valuation.data()).IsOne();
+      }
+
+      for (std::size_t i = 0; i < state_indices.size(); ++i) {
+        valuation[state_indices[i]] = next_state[i];
+      }
+    }
+  }
+
+  return outputs;
+}
+
+ControllerBenchmarkResult ControllerBenchmark::run(std::size_t trace_count,
+                                                   std::size_t trace_length,
+                                                   unsigned int seed) const {
+  TransducerExecutor executor(transducer_);
+  BitSlicedController controller(transducer_);
+
+  if (executor.input_count() == 0) {
+    throw std::runtime_error("Error: Cannot generate traces without inputs.");
+  }
+
+  std::mt19937 generator(seed);
+  std::bernoulli_distribution coin(0.5);
+  std::vector<std::vector<std::uint8_t>> traces(
+      trace_count,
+      std::vector<std::uint8_t>(trace_length * executor.input_count()));
+
+  for (std::vector<std::uint8_t>& trace : traces) {
+    for (std::uint8_t& bit : trace) {
+      bit = coin(generator);
+    }
+  }
+
+  ControllerBenchmarkResult result;
+  result.step_count = trace_count * trace_length;
+
+  Stopwatch eval;
+  eval.start();
+  std::vector<std::vector<std::uint8_t>> eval_outputs = run_eval(traces);
+  result.eval_time = eval.stop().count() / 1000.0;
+
+  Stopwatch flattened;
+  flattened.start();
+  std::vector<std::vector<std::uint8_t>> executor_outputs =
+      executor.run_batch(traces);
+  result.executor_time = flattened.stop().count() / 1000.0;
+
+  Stopwatch bit_sliced;
+  bit_sliced.start();
+  std::vector<std::vector<std::uint8_t>> controller_outputs =
+      controller.run_batch(traces);
+  result.bit_sliced_time = bit_sliced.stop().count() / 1000.0;
+
+  result.outputs_agree = eval_outputs == executor_outputs &&
+      eval_outputs == controller_outputs;
+
+  return result;
+}
+
+}
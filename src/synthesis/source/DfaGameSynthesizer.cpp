@@ -1,52 +1,42 @@
 #include "DfaGameSynthesizer.h"
 
-#include <cassert>
+#include <utility>
 
 namespace Syft {
 
 DfaGameSynthesizer::DfaGameSynthesizer(SymbolicStateDfa spec,
 				       Player starting_player,
-                       Player protagonist_player)
+                       Player protagonist_player,
+                       StrategyExtractionOptions extraction_options)
+    : DfaGameSynthesizer(spec, starting_player, protagonist_player,
+                         spec.var_mgr()->make_compose_vector(
+                             spec.automaton_id(), spec.transition_function()),
+                         extraction_options) {}
+
+DfaGameSynthesizer::DfaGameSynthesizer(SymbolicStateDfa spec,
+				       Player starting_player,
+                       Player protagonist_player,
+                       std::vector<CUDD::BDD> transition_vector,
+                       StrategyExtractionOptions extraction_options)
     : Synthesizer<SymbolicStateDfa>(spec)
     , starting_player_(starting_player)
-    , protagonist_player_(protagonist_player){
+    , protagonist_player_(protagonist_player)
+    , transition_vector_(std::move(transition_vector))
+    , extraction_options_(extraction_options){
   var_mgr_ = spec_.var_mgr();
   
   // Make versions of the initial state and transition function that can be used
-  // with CUDD::BDD::Eval and CUDD::BDD::VectorCompose, respectively
+  // with CUDD::BDD::Eval and CUDD::BDD::VectorCompose, respectively. The
+  // latter is given to the constructor
   initial_vector_ = var_mgr_->make_eval_vector(spec_.automaton_id(),
 					       spec_.initial_state());  
-  transition_vector_ = var_mgr_->make_compose_vector(
-      spec_.automaton_id(), spec_.transition_function());
   
-  CUDD::BDD input_cube = var_mgr_->input_cube();
-  CUDD::BDD output_cube = var_mgr_->output_cube();
-
-  // quantify_independent_variables_ quantifies all variables that the outputs
-  // don't depend on (input variables if the agent plays first, or no variables
-  // if the environment plays first). quantify_non_state_variables_ quantifies
-  // all remaining variables that are not state variables.
-  if (starting_player_ == Player::Environment) {
-      if (protagonist_player_ == Player::Environment) {
-          quantify_independent_variables_ = std::make_unique<Forall>(output_cube);
-          quantify_non_state_variables_ = std::make_unique<Exists>(input_cube);
-      } else {
-          quantify_independent_variables_ = std::make_unique<NoQuantification>();
-          quantify_non_state_variables_ = std::make_unique<ForallExists>(input_cube,
-                                                                         output_cube);
-      }
-  } else { // i.e. starting_player == Player::Agemt
-      if (protagonist_player_ == Player::Environment) {
-          quantify_independent_variables_ = std::make_unique<NoQuantification>();
-          quantify_non_state_variables_ = std::make_unique<ForallExists>(output_cube,
-                                                                         input_cube);
-      } else { // i.e. protagonist_player == Player::Agemt
-          quantify_independent_variables_ = std::make_unique<Forall>(input_cube);
-          quantify_non_state_variables_ = std::make_unique<Exists>(output_cube);
-      }
-  }
-
-
+  GameQuantifiers quantifiers = game_quantifiers(var_mgr_->input_cube(),
+                                                 var_mgr_->output_cube(),
+                                                 starting_player_,
+                                                 protagonist_player_);
+  quantify_independent_variables_ = std::move(quantifiers.independent_variables);
+  quantify_non_state_variables_ = std::move(quantifiers.non_state_variables);
 }
 
 CUDD::BDD DfaGameSynthesizer::preimage(
@@ -73,59 +63,11 @@ bool DfaGameSynthesizer::includes_initial_state(
   return winning_states.Eval(copy.data()).IsOne();
 }
 
-std::unordered_map<int, CUDD::BDD> DfaGameSynthesizer::synthesize_strategy(
-    const CUDD::BDD& winning_moves) const {
-  std::vector<CUDD::BDD> parameterized_output_function;
-  int* output_indices;
-  CUDD::BDD output_cube = var_mgr_->output_cube();
-  std::size_t output_count = var_mgr_->output_variable_count();
-
-  // Need to negate the BDD because b.SolveEqn(...) solves the equation b = 0
-  CUDD::BDD pre = (!winning_moves).SolveEqn(output_cube,
-					    parameterized_output_function,
-					    &output_indices,
-					    output_count);
-
-  // Copy the index since it will be necessary in the last step
-  std::vector<int> index_copy(output_count);
-
-  for (std::size_t i = 0; i < output_count; ++i) {
-    index_copy[i] = output_indices[i];
-  }
-
-  // Verify that the solution is correct, also frees output_index
-  CUDD::BDD verified = (!winning_moves).VerifySol(parameterized_output_function,
-						  output_indices);
-
-  assert(pre == verified);
-
-  std::unordered_map<int, CUDD::BDD> output_function;
-  
-  // Let y_i be the i-th output variable in the BDD ordering. The parameterized
-  // output function for y_i is of the form f_i(x_1, ..., x_m, p_i, ..., p_n)
-  // where p_i, ..., p_n are parameters taking the place of y_i, ..., y_n. All
-  // f_i are such that no matter what we replace p_i, ..., p_n with, the result
-  // is a valid output function. We replace the parameters with 1 so that all
-  // f_i are dependent only on the input and state variables.
-  for (int i = output_count - 1; i >= 0; --i) {
-      int output_index = index_copy[i];
-
-      output_function[output_index] = parameterized_output_function[i];
-
-      // TODO(Lucas): Replace inner loop with CUDD::BDD::VectorCompose
-      for (int j = output_count - 1; j >= i; --j) {
-          int parameter_index = index_copy[j];
-
-	  // Can be anything, set to the constant 1 for simplicity
-	  CUDD::BDD parameter_value = var_mgr_->cudd_mgr()->bddOne();
-
-	  output_function[output_index] =
-	    output_function[output_index].Compose(parameter_value,
-						  parameter_index);
-      }
-  }
+void DfaGameSynthesizer::attach_strategy(SynthesisResult& result,
+                                         const CUDD::BDD& winning_moves) const {
+  StrategyExtractor extractor(var_mgr_, protagonist_player_, extraction_options_);
 
-  return output_function;
+  extractor.attach_strategy(result, spec_, starting_player_, winning_moves);
 }
 
 }
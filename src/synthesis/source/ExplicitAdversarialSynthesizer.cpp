@@ -0,0 +1,94 @@
+/*
+* This file defines the class ExplicitAdversarialSynthesizer
+* which implements reactive synthesis under environment assumptions
+* by solving the reachability game over the explicit states of the DFA
+*/
+
+#include "ExplicitAdversarialSynthesizer.h"
+#include "CancellationToken.h"
+
+namespace Syft {
+
+    ExplicitAdversarialSynthesizer::ExplicitAdversarialSynthesizer(
+                            std::shared_ptr<VarMgr> var_mgr,
+                            std::string agent_specification,
+                            std::string environment_specification,
+                            InputOutputPartition partition,
+                            Player starting_player,
+                            ExplicitGameSolver solver) :   
+                                var_mgr_(var_mgr),
+                                agent_specification_(agent_specification),
+                                environment_specification_(environment_specification),
+                                partition_(partition),
+                                starting_player_(starting_player),
+                                solver_(solver)
+    {
+        RunningTimesScope running_times_scope(running_times_);
+
+        // step 1. Construct explicit-state DFA of LTLf formula E -> Phi
+        Stopwatch ltlf2dfa;
+        ltlf2dfa.start();
+
+        std::string adversarial_formula = 
+            "(" + environment_specification_ + ") -> (" + agent_specification_ + ")";
+
+        ExplicitStateDfaMona adversarial_formula_dfa = 
+            ExplicitStateDfaMona::dfa_of_formula(adversarial_formula); 
+
+        double t_ltlf2dfa = ltlf2dfa.stop().count() / 1000.0;
+        running_times_.push_back(t_ltlf2dfa);
+        std::cout << "[BeSyft] MONA DFA construction DONE in: " << t_ltlf2dfa << " s" << std::endl;
+
+        Syft::Stopwatch dfa2explicit;
+        dfa2explicit.start();
+
+        formula parsed_adversarial_formula = 
+            parse_formula(adversarial_formula.c_str()); // parses (E -> phi)
+
+        // Extract propositions from formula and partition
+        var_mgr_->create_named_variables(get_props(parsed_adversarial_formula)); // (E -> phi) includes all problem variables
+        var_mgr_->partition_variables(partition_.input_variables,
+                                        partition_.output_variables);
+
+        // No symbolic encoding of the state space: the game is solved on the explicit-state DFA
+        explicit_dfa_.push_back(ExplicitStateDfa::from_dfa_mona(var_mgr_, adversarial_formula_dfa));
+
+        double t_dfa2explicit = dfa2explicit.stop().count() / 1000.0;
+        std::cout << "[BeSyft] Explicit-state DFA construction DONE in " << t_dfa2explicit << std::endl;
+        running_times_.push_back(t_dfa2explicit);
+    }                        
+
+    SynthesisResult ExplicitAdversarialSynthesizer::run() 
+    {
+        RunningTimesScope running_times_scope(running_times_);
+
+        SynthesisResult adv_result;
+
+        // Step 2. Decide the adversarial game over the explicit states of the DFA
+        Stopwatch advGame;
+        advGame.start();
+        if (solver_ == ExplicitGameSolver::BitParallel) {
+            std::cout << "[BeSyft] Constructing and solving bit-parallel adversarial game...";
+            BitParallelReachabilitySynthesizer adv_synthesizer(explicit_dfa_[0],
+                                                               starting_player_,
+                                                               Player::Agent,
+                                                               explicit_dfa_[0].final_states());
+            adv_result = adv_synthesizer.run();
+        } else {
+            std::cout << "[BeSyft] Constructing and solving hybrid adversarial game...";
+            HybridReachabilitySynthesizer adv_synthesizer(explicit_dfa_[0],
+                                                          starting_player_,
+                                                          Player::Agent,
+                                                          explicit_dfa_[0].final_states());
+            adv_result = adv_synthesizer.run();
+        }
+        double t_advGame = advGame.stop().count() / 1000.0;
+        running_times_.push_back(t_advGame);
+        std::cout << "DONE in " << t_advGame << " s" << std::endl;
+        return adv_result;
+    }
+
+    std::vector<double> ExplicitAdversarialSynthesizer::get_running_times() const {
+        return running_times_;
+    }                                      
+}
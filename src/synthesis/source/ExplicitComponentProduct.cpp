@@ -0,0 +1,201 @@
+#include "ExplicitComponentProduct.h"
+
+#include "SymbolicStateDfa.h"
+
+namespace Syft {
+
+ExplicitComponentProduct::ExplicitComponentProduct(
+    std::shared_ptr<VarMgr> var_mgr,
+    const ExplicitStateDfa& agent_dfa,
+    const ExplicitStateDfa& environment_dfa,
+    const ExplicitStateDfa& tautology_dfa,
+    Player starting_player)
+    : var_mgr_(std::move(var_mgr)) {
+  components_.push_back(agent_dfa);
+  components_.push_back(environment_dfa);
+  components_.push_back(tautology_dfa);
+
+  // Classes consistent with all components at once, so that one letter class
+  // moves every component deterministically
+  LetterClasses letter_classes(var_mgr_, components_);
+  const LetterPartition* outer_partition =
+      &letter_classes.first_mover_partition(starting_player);
+  const LetterPartition* inner_partition =
+      &letter_classes.second_mover_partition(starting_player);
+
+  outer_exists_ = (starting_player == Player::Agent);
+  outer_letter_count_ = outer_partition->class_count();
+  inner_letter_count_ = inner_partition->class_count();
+
+  std::size_t letter_count = outer_letter_count_ * inner_letter_count_;
+  std::vector<int> letter(var_mgr_->total_variable_count());
+
+  successor_tables_.resize(components_.size());
+  final_states_.resize(components_.size());
+
+  for (std::size_t c = 0; c < components_.size(); ++c) {
+    successor_tables_[c].resize(components_[c].state_count() * letter_count);
+    final_states_[c].resize(components_[c].state_count(), false);
+
+    for (std::size_t state : components_[c].final_states()) {
+      final_states_[c][state] = true;
+    }
+  }
+
+  for (std::size_t c = 0; c < components_.size(); ++c) {
+    std::vector<CUDD::ADD> transition_function =
+        components_[c].transition_function();
+
+    for (std::size_t outer = 0; outer < outer_letter_count_; ++outer) {
+      for (std::size_t inner = 0; inner < inner_letter_count_; ++inner) {
+        for (std::size_t i = 0; i < letter.size(); ++i) {
+          letter[i] = outer_partition->representatives[outer][i] +
+                      inner_partition->representatives[inner][i];
+        }
+
+        std::size_t column = outer * inner_letter_count_ + inner;
+
+        for (std::size_t state = 0; state < components_[c].state_count(); ++state) {
+          successor_tables_[c][state * letter_count + column] =
+              LetterClasses::successor(transition_function[state], letter);
+        }
+      }
+    }
+  }
+
+  // Inverted once, for solvers working backward from the goal
+  predecessor_tables_.resize(components_.size());
+
+  for (std::size_t c = 0; c < components_.size(); ++c) {
+    std::size_t state_count = components_[c].state_count();
+    predecessor_tables_[c].resize(letter_count * state_count);
+
+    for (std::size_t state = 0; state < state_count; ++state) {
+      for (std::size_t column = 0; column < letter_count; ++column) {
+        std::size_t successor = successor_tables_[c][state * letter_count + column];
+        predecessor_tables_[c][column * state_count + successor].push_back(state);
+      }
+    }
+  }
+
+  for (const ExplicitStateDfa& component : components_) {
+    encoding_automaton_ids_.push_back(SymbolicStateDfa::create_state_variables(
+        var_mgr_, component.state_count()).second);
+  }
+}
+
+std::size_t ExplicitComponentProduct::component_count() const {
+  return components_.size();
+}
+
+const ExplicitStateDfa& ExplicitComponentProduct::component(std::size_t c) const {
+  return components_[c];
+}
+
+double ExplicitComponentProduct::product_state_count() const {
+  double count = 1;
+
+  for (const ExplicitStateDfa& component : components_) {
+    count *= component.state_count();
+  }
+
+  return count;
+}
+
+ExplicitComponentProduct::ProductState
+ExplicitComponentProduct::initial_state() const {
+  ProductState state;
+
+  for (const ExplicitStateDfa& component : components_) {
+    state.push_back(component.initial_state());
+  }
+
+  return state;
+}
+
+bool ExplicitComponentProduct::is_final(std::size_t c, std::size_t state) const {
+  return final_states_[c][state];
+}
+
+bool ExplicitComponentProduct::is_goal(const ProductState& state) const {
+  return is_final(tautology_component, state[tautology_component]) &&
+      (!is_final(environment_component, state[environment_component]) ||
+       is_final(agent_component, state[agent_component]));
+}
+
+std::size_t ExplicitComponentProduct::outer_letter_count() const {
+  return outer_letter_count_;
+}
+
+std::size_t ExplicitComponentProduct::inner_letter_count() const {
+  return inner_letter_count_;
+}
+
+bool ExplicitComponentProduct::outer_exists() const {
+  return outer_exists_;
+}
+
+std::size_t ExplicitComponentProduct::successor(std::size_t c,
+                                                std::size_t state,
+                                                std::size_t outer,
+                                                std::size_t inner) const {
+  std::size_t letter_count = outer_letter_count_ * inner_letter_count_;
+
+  return successor_tables_[c][state * letter_count +
+                              outer * inner_letter_count_ + inner];
+}
+
+ExplicitComponentProduct::ProductState ExplicitComponentProduct::successor(
+    const ProductState& state,
+    std::size_t outer,
+    std::size_t inner) const {
+  ProductState result(state.size());
+
+  for (std::size_t c = 0; c < state.size(); ++c) {
+    result[c] = successor(c, state[c], outer, inner);
+  }
+
+  return result;
+}
+
+const std::vector<std::size_t>& ExplicitComponentProduct::predecessors(
+    std::size_t c,
+    std::size_t state,
+    std::size_t outer,
+    std::size_t inner) const {
+  std::size_t column = outer * inner_letter_count_ + inner;
+
+  return predecessor_tables_[c][column * components_[c].state_count() + state];
+}
+
+CUDD::BDD ExplicitComponentProduct::product_states_to_bdd(
+    const std::vector<ProductState>& states) const {
+  CUDD::BDD result = var_mgr_->cudd_mgr()->bddZero();
+
+  for (const ProductState& state : states) {
+    CUDD::BDD state_bdd = var_mgr_->cudd_mgr()->bddOne();
+
+    for (std::size_t c = 0; c < state.size(); ++c) {
+      state_bdd &= SymbolicStateDfa::state_set_to_bdd(
+          var_mgr_, encoding_automaton_ids_[c], {state[c]});
+    }
+
+    result |= state_bdd;
+  }
+
+  return result;
+}
+
+CUDD::BDD ExplicitComponentProduct::component_sets_to_bdd(
+    const std::vector<std::vector<std::size_t>>& state_sets) const {
+  CUDD::BDD result = var_mgr_->cudd_mgr()->bddOne();
+
+  for (std::size_t c = 0; c < state_sets.size(); ++c) {
+    result &= SymbolicStateDfa::state_set_to_bdd(
+        var_mgr_, encoding_automaton_ids_[c], state_sets[c]);
+  }
+
+  return result;
+}
+
+}
@@ -4,6 +4,7 @@
 */
 
 #include "ExplicitCompositionalBestEffortSynthesizer.h"
+#include "CancellationToken.h"
 #include <boost/algorithm/string.hpp>
 #include <queue>
 
@@ -14,12 +15,16 @@ namespace Syft {
                                                 std::string agent_specification,
                                                 std::string environment_specification,
                                                 InputOutputPartition partition,
-                                                Player starting_player) :   var_mgr_(var_mgr),
+                                                Player starting_player,
+                                                StrategyExtractionOptions extraction_options) :   var_mgr_(var_mgr),
                                                                             agent_specification_(agent_specification),
                                                                             environment_specification_(environment_specification),
                                                                             partition_(partition),
-                                                                            starting_player_(starting_player) 
+                                                                            starting_player_(starting_player),
+                                                                            extraction_options_(extraction_options) 
     {
+        RunningTimesScope running_times_scope(running_times_);
+
         // step 1. Construct symbolic DFAs of formulas {E -> phi, !E, E /\ phi}
         // Build MONA DFAs for agent and environment specifications
 
@@ -115,6 +120,7 @@ namespace Syft {
     }
 
     std::pair<SynthesisResult, SynthesisResult> ExplicitCompositionalBestEffortSynthesizer::run() {
+        RunningTimesScope running_times_scope(running_times_);
 
         std::pair<SynthesisResult, SynthesisResult> best_effort_result;
 
@@ -130,12 +136,21 @@ namespace Syft {
                                                 starting_player_,
                                                 Player::Agent,
                                                 adv_goal, // Lifting
-                                                var_mgr_->cudd_mgr()->bddOne());
+                                                var_mgr_->cudd_mgr()->bddOne(),
+                                                extraction_options_);
         best_effort_result.first = adv_synthesizer.run();
         double t_advGame = advGame.stop().count() / 1000.0;
         running_times_.push_back(t_advGame);
         std::cout << "DONE in " << t_advGame << " s" << std::endl;
 
+        anytime_options_.report(BestEffortPhase::Adversarial, best_effort_result.first, t_advGame);
+
+        if (anytime_options_.skip_cooperative_if_winning && best_effort_result.first.realizability) {
+            std::cout << "[BeSyft] Adversarially realizable, cooperative game skipped" << std::endl;
+            best_effort_result.second = AnytimeOptions::cooperative_from_adversarial(best_effort_result.first);
+            return best_effort_result;
+        }
+
         // Step 4. Compute environment's winning region in negation of environment game
         Stopwatch coopGame;
         coopGame.start();
@@ -144,7 +159,8 @@ namespace Syft {
                                                     starting_player_,
                                                     Player::Agent,  // gets env winning region from agent's
                                                     neg_goal, // Lifting
-                                                    var_mgr_->cudd_mgr()->bddOne());
+                                                    var_mgr_->cudd_mgr()->bddOne(),
+                                                    extraction_options_);
         SynthesisResult env_result = neg_env_synthesizer.run();
         CUDD::BDD non_environment_winning_region = env_result.winning_states;
 
@@ -157,44 +173,19 @@ namespace Syft {
                                                             starting_player_,
                                                             Player::Agent,
                                                             coop_goal, // Lifting
-                                                            var_mgr_->cudd_mgr()->bddOne()); 
+                                                            var_mgr_->cudd_mgr()->bddOne(),
+                                                            extraction_options_); 
         best_effort_result.second = coop_synthesizer.run();
         double t_coopGame = coopGame.stop().count() / 1000.0;
         running_times_.push_back(t_coopGame);
         std::cout << "DONE in " << t_coopGame << " s" << std::endl; 
+        anytime_options_.report(BestEffortPhase::Cooperative, best_effort_result.second, t_coopGame);
 
         return best_effort_result;
     }
 
-    void ExplicitCompositionalBestEffortSynthesizer::merge_and_dump_dot(const SynthesisResult& adversarial_result, const SynthesisResult& cooperative_result, const std::string& filename) const {
-        Syft::Stopwatch merge;
-        merge.start();
-        std::cout << "[BeSyft] Merging strategies...";
-
-        std::vector<std::string> output_labels = var_mgr_->output_variable_labels(); // i.e. Y variables
-
-        std::size_t output_count = cooperative_result.transducer.get()->output_function_.size();
-        std::vector<CUDD::ADD> output_vector(output_count);
-
-        // Cooperatively only winning states, i.e. states in cooperatively, but not reactively, winning region
-        CUDD::BDD cooperative_only_winning_states = (!adversarial_result.winning_states) * cooperative_result.winning_states;
-        for(std::size_t i=0; i < output_count; ++i) {
-            std::string label = output_labels[i];
-            int index = var_mgr_->name_to_variable(label).NodeReadIndex();
-            // i. For winning states use adversarial output function
-            CUDD::BDD restricted_adversarial_bdd = 
-                adversarial_result.transducer.get()->output_function_.at(index) * adversarial_result.winning_states; 
-            // ii. For cooperatively only winning states use cooperative output function
-            CUDD::BDD restricted_cooperative_bdd = 
-                cooperative_result.transducer.get()->output_function_.at(index) * cooperative_only_winning_states; 
-            /// iii. For any state keep best-effort output
-            CUDD::BDD merged_bdd = restricted_adversarial_bdd + restricted_cooperative_bdd;
-            output_vector[i] = merged_bdd.Add();
-        }
-        var_mgr_->dump_dot(output_vector, output_labels, filename);
-
-        double t_merge = merge.stop().count() / 1000.0;
-        std::cout << "DONE in " <<  t_merge << " s" << std::endl;
+    void ExplicitCompositionalBestEffortSynthesizer::set_anytime_options(AnytimeOptions anytime_options) {
+        anytime_options_ = std::move(anytime_options);
     }
 
     std::vector<double> ExplicitCompositionalBestEffortSynthesizer::get_running_times() const {
@@ -4,6 +4,7 @@
 
 #include "ExplicitStateDfaMona.h"
 
+#include "CancellationToken.h"
 #include "spotparser.h"
 #include <iostream>
 #include <istream>
@@ -141,6 +142,8 @@ namespace Syft
 
     ExplicitStateDfaMona ExplicitStateDfaMona::dfa_of_formula(const std::string &formula)
     {
+        CancellationToken::global().check();
+
         std::shared_ptr<whitemech::lydia::AbstractDriver> driver;
         driver = std::make_shared<whitemech::lydia::parsers::ltlf::LTLfDriver>();
         std::stringstream formula_stream(formula);
@@ -161,6 +164,7 @@ namespace Syft
         auto translator = whitemech::lydia::Translator(dfa_strategy);
 
         auto my_dfa = translator.to_dfa(*ldlf_parsed_formula);
+        CancellationToken::global().check();
 
         auto my_mona_dfa =
             std::dynamic_pointer_cast<whitemech::lydia::mona_dfa>(my_dfa);
@@ -217,6 +221,16 @@ namespace Syft
             queue(renamed_dfa_vector.begin(), renamed_dfa_vector.end(), cmp);
         while (queue.size() > 1)
         {
+            if (CancellationToken::global().cancelled())
+            {
+                while (!queue.empty())
+                {
+                    dfaFree(queue.top());
+                    queue.pop();
+                }
+                throw SynthesisTimeout();
+            }
+
             DFA *lhs = queue.top();
             queue.pop();
             DFA *rhs = queue.top();
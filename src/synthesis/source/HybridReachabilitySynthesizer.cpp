@@ -0,0 +1,143 @@
+#include "HybridReachabilitySynthesizer.h"
+
+#include <deque>
+
+#include "CancellationToken.h"
+#include "SymbolicStateDfa.h"
+
+namespace Syft {
+
+HybridReachabilitySynthesizer::HybridReachabilitySynthesizer(
+    ExplicitStateDfa spec,
+    Player starting_player,
+    Player protagonist_player,
+    std::vector<std::size_t> goal_states)
+    : Synthesizer<ExplicitStateDfa>(spec)
+    , starting_player_(starting_player)
+    , protagonist_player_(protagonist_player)
+    , goal_states_(std::move(goal_states)) {
+  var_mgr_ = spec_.var_mgr();
+
+  // Created once, so that solving again does not add variables to the manager
+  std::shared_ptr<VarMgr> var_mgr = var_mgr_;
+  winning_state_automaton_id_ =
+      SymbolicStateDfa::create_state_variables(var_mgr, spec_.state_count()).second;
+
+  LetterClasses letter_classes(var_mgr_, {spec_});
+  const LetterPartition& partition = letter_classes.joint_partition();
+  std::vector<CUDD::ADD> transition_function = spec_.transition_function();
+
+  letter_classes_ = partition.classes;
+  class_successors_.resize(spec_.state_count());
+  predecessors_.resize(spec_.state_count());
+
+  // One successor per class replaces the ADD of each state, and the
+  // predecessor lists are read off the successors without touching any letter
+  std::vector<std::size_t> last_seen(spec_.state_count(), spec_.state_count());
+
+  for (std::size_t state = 0; state < transition_function.size(); ++state) {
+    for (const std::vector<int>& representative : partition.representatives) {
+      std::size_t successor =
+          LetterClasses::successor(transition_function[state], representative);
+      class_successors_[state].push_back(successor);
+
+      if (last_seen[successor] != state) {
+        last_seen[successor] = state;
+        predecessors_[successor].push_back(state);
+      }
+    }
+  }
+
+  // Same quantifier prefixes as DfaGameSynthesizer, applied to the letters
+  // leading into the winning region instead of the composed transition BDD
+  GameQuantifiers quantifiers = game_quantifiers(var_mgr_->input_cube(),
+                                                 var_mgr_->output_cube(),
+                                                 starting_player_,
+                                                 protagonist_player_);
+  quantify_independent_variables_ = std::move(quantifiers.independent_variables);
+  quantify_non_state_variables_ = std::move(quantifiers.non_state_variables);
+}
+
+CUDD::BDD HybridReachabilitySynthesizer::winning_letters(
+    std::size_t state,
+    const boost::dynamic_bitset<>& winning_states) const {
+  CUDD::BDD letters = var_mgr_->cudd_mgr()->bddZero();
+
+  for (std::size_t c = 0; c < letter_classes_.size(); ++c) {
+    if (winning_states[class_successors_[state][c]]) {
+      letters |= letter_classes_[c];
+    }
+  }
+
+  return letters;
+}
+
+boost::dynamic_bitset<> HybridReachabilitySynthesizer::winning_region(
+    bool stop_at_initial) const {
+  std::size_t state_count = spec_.state_count();
+  std::size_t initial_state = spec_.initial_state();
+
+  boost::dynamic_bitset<> winning_states(state_count);
+  std::deque<std::size_t> worklist;
+
+  for (std::size_t goal_state : goal_states_) {
+    winning_states.set(goal_state);
+  }
+
+  for (std::size_t goal_state : goal_states_) {
+    worklist.insert(worklist.end(), predecessors_[goal_state].begin(),
+                    predecessors_[goal_state].end());
+  }
+
+  // Only predecessors of newly won states can change their status, so the
+  // worklist replaces the full sweep over the state space of each iteration
+  while (!worklist.empty()) {
+    CancellationToken::global().check();
+
+    if (stop_at_initial && winning_states[initial_state]) {
+      break;
+    }
+
+    std::size_t state = worklist.front();
+    worklist.pop_front();
+
+    if (winning_states[state]) {
+      continue;
+    }
+
+    CUDD::BDD letters = quantify_independent_variables_->apply(
+        winning_letters(state, winning_states));
+
+    if (quantify_non_state_variables_->apply(letters).IsOne()) {
+      winning_states.set(state);
+      worklist.insert(worklist.end(), predecessors_[state].begin(),
+                      predecessors_[state].end());
+    }
+  }
+
+  return winning_states;
+}
+
+SynthesisResult HybridReachabilitySynthesizer::run() const {
+  SynthesisResult result;
+  boost::dynamic_bitset<> winning_states = winning_region(true);
+
+  result.realizability = winning_states[spec_.initial_state()];
+
+  // Encode the winning region only once, after the game is solved
+  std::vector<std::size_t> winning_state_list;
+
+  for (std::size_t state = winning_states.find_first();
+       state != boost::dynamic_bitset<>::npos;
+       state = winning_states.find_next(state)) {
+    winning_state_list.push_back(state);
+  }
+
+  result.winning_states = SymbolicStateDfa::state_set_to_bdd(
+      var_mgr_, winning_state_automaton_id_, winning_state_list);
+  result.transducer = nullptr;
+
+  return result;
+}
+
+}
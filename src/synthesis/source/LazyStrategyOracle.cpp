@@ -0,0 +1,172 @@
+#include "LazyStrategyOracle.h"
+
+#include <stdexcept>
+#include <unordered_set>
+
+namespace Syft {
+
+LazyStrategyOracle::LazyStrategyOracle(std::shared_ptr<VarMgr> var_mgr,
+                                       std::size_t automaton_id,
+                                       CUDD::BDD winning_moves,
+                                       std::vector<int> initial_state,
+                                       Player protagonist_player,
+                                       std::size_t cache_capacity)
+    : var_mgr_(std::move(var_mgr))
+    , winning_moves_(std::move(winning_moves))
+    , initial_state_(std::move(initial_state))
+    , cache_capacity_(cache_capacity) {
+  std::vector<std::string> input_labels;
+  std::vector<std::string> output_labels;
+
+  if (protagonist_player == Player::Environment) {
+    input_labels = var_mgr_->output_variable_labels();
+    output_labels = var_mgr_->input_variable_labels();
+  } else {
+    input_labels = var_mgr_->input_variable_labels();
+    output_labels = var_mgr_->output_variable_labels();
+  }
+
+  for (std::size_t i = 0; i < var_mgr_->state_variable_count(automaton_id); ++i) {
+    state_indices_.push_back(
+        var_mgr_->state_variable(automaton_id, i).NodeReadIndex());
+  }
+
+  for (const std::string& label : input_labels) {
+    input_indices_.push_back(var_mgr_->name_to_variable(label).NodeReadIndex());
+  }
+
+  for (const std::string& label : output_labels) {
+    output_indices_.push_back(var_mgr_->name_to_variable(label).NodeReadIndex());
+  }
+
+  // Variables outside the game are never on a path of the winning moves
+  valuation_.assign(var_mgr_->total_variable_count(), 0);
+  chosen_.assign(var_mgr_->total_variable_count(), 0);
+}
+
+bool LazyStrategyOracle::search(DdNode* node,
+                                std::unordered_set<DdNode*>& failed) const {
+  DdNode* regular = Cudd_Regular(node);
+
+  if (Cudd_IsConstant(regular)) {
+    return !Cudd_IsComplement(node);
+  } else if (failed.count(node) > 0) {
+    return false;
+  }
+
+  DdNode* then_child = Cudd_T(regular);
+  DdNode* else_child = Cudd_E(regular);
+
+  if (Cudd_IsComplement(node)) {
+    then_child = Cudd_Not(then_child);
+    else_child = Cudd_Not(else_child);
+  }
+
+  int index = Cudd_NodeReadIndex(regular);
+
+  if (valuation_[index] == 1) {
+    if (search(then_child, failed)) {
+      return true;
+    }
+  } else if (valuation_[index] == 0) {
+    if (search(else_child, failed)) {
+      return true;
+    }
+  } else if (search(then_child, failed)) {
+    // Free variables are only bound on the path that succeeds
+    chosen_[index] = 1;
+    return true;
+  } else if (search(else_child, failed)) {
+    chosen_[index] = 0;
+    return true;
+  }
+
+  failed.insert(node);
+
+  return false;
+}
+
+bool LazyStrategyOracle::query(const std::vector<std::uint8_t>& state,
+                               const std::vector<std::uint8_t>& input,
+                               std::vector<std::uint8_t>& output) const {
+  if (state.size() != state_indices_.size() ||
+      input.size() != input_indices_.size()) {
+    throw std::runtime_error("Error: Strategy query has the wrong number of variables.");
+  }
+
+  Key key(state);
+  key.insert(key.end(), input.begin(), input.end());
+
+  auto cached = cache_index_.find(key);
+
+  if (cached != cache_index_.end()) {
+    ++hits_;
+    cache_.splice(cache_.begin(), cache_, cached->second);
+    output = cached->second->output;
+    return cached->second->found;
+  }
+
+  ++misses_;
+
+  for (std::size_t i = 0; i < state_indices_.size(); ++i) {
+    valuation_[state_indices_[i]] = state[i];
+  }
+
+  for (std::size_t i = 0; i < input_indices_.size(); ++i) {
+    valuation_[input_indices_[i]] = input[i];
+  }
+
+  for (int index : output_indices_) {
+    valuation_[index] = -1;
+    chosen_[index] = 0;
+  }
+
+  std::unordered_set<DdNode*> failed;
+  bool found = search(winning_moves_.getNode(), failed);
+
+  output.assign(output_indices_.size(), 0);
+
+  for (std::size_t i = 0; i < output_indices_.size(); ++i) {
+    output[i] = chosen_[output_indices_[i]];
+  }
+
+  if (cache_capacity_ > 0) {
+    if (cache_.size() == cache_capacity_) {
+      cache_index_.erase(cache_.back().key);
+      cache_.pop_back();
+    }
+
+    cache_.push_front({key, found, output});
+    cache_index_.emplace(std::move(key), cache_.begin());
+  }
+
+  return found;
+}
+
+std::vector<std::uint8_t> LazyStrategyOracle::initial_state() const {
+  std::vector<std::uint8_t> state;
+
+  for (int bit : initial_state_) {
+    state.push_back(bit ? 1 : 0);
+  }
+
+  return state;
+}
+
+std::size_t LazyStrategyOracle::input_count() const {
+  return input_indices_.size();
+}
+
+std::size_t LazyStrategyOracle::output_count() const {
+  return output_indices_.size();
+}
+
+std::size_t LazyStrategyOracle::cache_hits() const {
+  return hits_;
+}
+
+std::size_t LazyStrategyOracle::cache_misses() const {
+  return misses_;
+}
+
+}
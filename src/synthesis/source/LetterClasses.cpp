@@ -0,0 +1,219 @@
+#include "LetterClasses.h"
+
+#include <algorithm>
+#include <set>
+
+namespace Syft {
+
+std::size_t LetterPartition::class_count() const {
+  return classes.size();
+}
+
+std::size_t LetterPartition::class_of(const std::vector<int>& valuation) const {
+  std::vector<int> copy(valuation);
+
+  for (std::size_t i = 0; i < classes.size(); ++i) {
+    if (classes[i].Eval(copy.data()).IsOne()) {
+      return i;
+    }
+  }
+
+  throw std::runtime_error("Error: Valuation outside of every letter class.");
+}
+
+LetterClasses::LetterClasses(std::shared_ptr<VarMgr> var_mgr,
+                             const std::vector<ExplicitStateDfa>& dfas)
+    : var_mgr_(std::move(var_mgr)) {
+  // States with the same transition ADD do not distinguish more letters, so
+  // each distinct ADD is considered once
+  std::set<DdNode*> seen;
+
+  for (const ExplicitStateDfa& dfa : dfas) {
+    for (const CUDD::ADD& transition_function : dfa.transition_function()) {
+      if (seen.insert(transition_function.getNode()).second) {
+        functions_.push_back(transition_function);
+      }
+    }
+  }
+
+  compute_partitions();
+}
+
+LetterClasses::LetterClasses(std::shared_ptr<VarMgr> var_mgr,
+                             std::vector<CUDD::ADD> functions)
+    : var_mgr_(std::move(var_mgr))
+    , functions_(std::move(functions)) {
+  compute_partitions();
+}
+
+void LetterClasses::compute_partitions() {
+  std::vector<std::string> input_names = var_mgr_->input_variable_labels();
+  std::vector<std::string> output_names = var_mgr_->output_variable_labels();
+  std::vector<std::string> all_names(input_names);
+  all_names.insert(all_names.end(), output_names.begin(), output_names.end());
+
+  joint_partition_ = partition(all_names);
+  input_partition_ = partition(input_names);
+  output_partition_ = partition(output_names);
+}
+
+LetterClasses::Signature LetterClasses::signature_of(
+    const std::vector<CUDD::ADD>& functions) {
+  Signature signature;
+  signature.reserve(functions.size());
+
+  for (const CUDD::ADD& function : functions) {
+    signature.push_back(function.getNode());
+  }
+
+  return signature;
+}
+
+const std::vector<std::pair<std::size_t, CUDD::BDD>>& LetterClasses::refine(
+    const std::vector<CUDD::ADD>& functions,
+    std::size_t position,
+    const std::vector<int>& variable_indices,
+    std::map<std::pair<std::size_t, Signature>, Refinement>& refinement_table,
+    std::map<Signature, std::size_t>& class_ids) const {
+  Signature signature = signature_of(functions);
+  auto key = std::make_pair(position, signature);
+  auto it = refinement_table.find(key);
+
+  if (it != refinement_table.end()) {
+    return it->second.classes;
+  }
+
+  std::shared_ptr<CUDD::Cudd> mgr = var_mgr_->cudd_mgr();
+  Refinement refinement;
+  // Keeps the functions referenced, so that their nodes are not recycled
+  // while they are used as a key
+  refinement.functions = functions;
+
+  if (position == variable_indices.size()) {
+    // All variables of the partition are assigned: the remaining functions
+    // identify the class
+    auto inserted = class_ids.emplace(signature, class_ids.size());
+    refinement.classes.emplace_back(inserted.first->second, mgr->bddOne());
+  } else {
+    int index = variable_indices[position];
+    std::vector<CUDD::ADD> high, low;
+    bool depends = false;
+
+    for (const CUDD::ADD& function : functions) {
+      high.push_back(function.Compose(mgr->addOne(), index));
+      low.push_back(function.Compose(mgr->addZero(), index));
+      depends = depends || high.back() != low.back();
+    }
+
+    if (!depends) {
+      refinement.classes = refine(functions, position + 1, variable_indices,
+                                  refinement_table, class_ids);
+    } else {
+      const auto& high_classes = refine(high, position + 1, variable_indices,
+                                        refinement_table, class_ids);
+      const auto& low_classes = refine(low, position + 1, variable_indices,
+                                       refinement_table, class_ids);
+
+      // A class reached on both sides is the union of the two cofactors
+      CUDD::BDD variable = mgr->bddVar(index);
+      std::map<std::size_t, CUDD::BDD> merged;
+
+      for (const auto& c : high_classes) {
+        merged[c.first] = variable & c.second;
+      }
+
+      for (const auto& c : low_classes) {
+        auto m = merged.find(c.first);
+
+        if (m == merged.end()) {
+          merged[c.first] = (!variable) & c.second;
+        } else {
+          m->second = variable.Ite(m->second, c.second);
+        }
+      }
+
+      refinement.classes.assign(merged.begin(), merged.end());
+    }
+  }
+
+  return refinement_table.emplace(key, std::move(refinement)).first->second.classes;
+}
+
+LetterPartition LetterClasses::partition(
+    const std::vector<std::string>& variable_names) const {
+  std::shared_ptr<CUDD::Cudd> mgr = var_mgr_->cudd_mgr();
+  LetterPartition result;
+
+  for (const std::string& name : variable_names) {
+    result.variable_indices.push_back(var_mgr_->name_to_variable(name).NodeReadIndex());
+  }
+
+  // Cofactoring in the CUDD order keeps the class BDDs cheap to build
+  std::sort(result.variable_indices.begin(), result.variable_indices.end(),
+            [&mgr] (int lhs, int rhs) {
+              return mgr->ReadPerm(lhs) < mgr->ReadPerm(rhs);
+            });
+
+  std::map<std::pair<std::size_t, Signature>, Refinement> refinement_table;
+  std::map<Signature, std::size_t> class_ids;
+  const auto& classes = refine(functions_, 0,
+                               result.variable_indices, refinement_table,
+                               class_ids);
+
+  result.classes.resize(class_ids.size());
+
+  for (const auto& c : classes) {
+    result.classes[c.first] = c.second;
+  }
+
+  std::vector<char> cube(mgr->ReadSize());
+
+  for (const CUDD::BDD& letter_class : result.classes) {
+    std::vector<int> representative(var_mgr_->total_variable_count(), 0);
+    letter_class.PickOneCube(cube.data());
+
+    // Variables the class does not depend on are set to 0
+    for (int index : result.variable_indices) {
+      representative[index] = (cube[index] == 1) ? 1 : 0;
+    }
+
+    result.representatives.push_back(representative);
+  }
+
+  return result;
+}
+
+const LetterPartition& LetterClasses::joint_partition() const {
+  return joint_partition_;
+}
+
+const LetterPartition& LetterClasses::input_partition() const {
+  return input_partition_;
+}
+
+const LetterPartition& LetterClasses::output_partition() const {
+  return output_partition_;
+}
+
+const LetterPartition& LetterClasses::first_mover_partition(
+    Player starting_player) const {
+  return starting_player == Player::Agent ? output_partition_ : input_partition_;
+}
+
+const LetterPartition& LetterClasses::second_mover_partition(
+    Player starting_player) const {
+  return starting_player == Player::Agent ? input_partition_ : output_partition_;
+}
+
+std::size_t LetterClasses::successor(const CUDD::ADD& transition_function,
+                                     const std::vector<int>& valuation) {
+  DdNode* node = transition_function.getNode();
+
+  while (!Cudd_IsConstant(node)) {
+    node = valuation[Cudd_NodeReadIndex(node)] ? Cudd_T(node) : Cudd_E(node);
+  }
+
+  return static_cast<std::size_t>(Cudd_V(node));
+}
+
+}
@@ -0,0 +1,366 @@
+#include "MealyMachine.h"
+
+#include <deque>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
+
+#include "LetterClasses.h"
+#include "TransducerExecutor.h"
+
+namespace Syft {
+
+namespace {
+
+// Copies the ADD mapping input valuations to letters into a node array,
+// reading input variables as bits of an input word
+template <class LetterNode>
+std::uint32_t flatten_letters(
+    DdNode* node,
+    const std::unordered_map<int, std::int32_t>& bits,
+    std::unordered_map<DdNode*, std::uint32_t>& positions,
+    std::vector<LetterNode>& nodes) {
+  auto found = positions.find(node);
+
+  if (found != positions.end()) {
+    return found->second;
+  }
+
+  std::uint32_t position = nodes.size();
+  positions.emplace(node, position);
+  nodes.push_back({-1, 0, 0});
+
+  if (Cudd_IsConstant(node)) {
+    nodes[position].then_node = static_cast<std::uint32_t>(Cudd_V(node));
+  } else {
+    std::int32_t bit = bits.at(Cudd_NodeReadIndex(node));
+    std::uint32_t then_node = flatten_letters(Cudd_T(node), bits, positions, nodes);
+    std::uint32_t else_node = flatten_letters(Cudd_E(node), bits, positions, nodes);
+    nodes[position] = {bit, then_node, else_node};
+  }
+
+  return position;
+}
+
+}
+
+MealyMachine::MealyMachine(std::vector<std::string> input_labels,
+                           std::vector<std::string> output_labels)
+    : input_labels_(std::move(input_labels))
+    , output_labels_(std::move(output_labels))
+    , letter_count_(0)
+{}
+
+MealyMachine MealyMachine::from_transducer(const Transducer& transducer,
+                                           std::size_t max_letter_count) {
+  MealyMachine machine(transducer.input_labels(), transducer.output_labels());
+  std::size_t input_count = machine.input_labels_.size();
+  std::size_t output_count = machine.output_labels_.size();
+
+  if (input_count > 64) {
+    throw std::runtime_error("Error: Mealy machines support at most 64 inputs.");
+  } else if (output_count > 64) {
+    throw std::runtime_error("Error: Mealy machines support at most 64 outputs.");
+  }
+
+  std::shared_ptr<VarMgr> var_mgr = transducer.var_mgr_;
+  std::shared_ptr<CUDD::Cudd> mgr = var_mgr->cudd_mgr();
+
+  // Substituting the output functions makes the next state a function of the
+  // state and the inputs only
+  std::vector<CUDD::BDD> output_substitution;
+
+  for (int index = 0; index < mgr->ReadSize(); ++index) {
+    output_substitution.push_back(mgr->bddVar(index));
+  }
+
+  for (std::size_t i = 0; i < transducer.output_indices_.size(); ++i) {
+    output_substitution[transducer.output_indices_[i]] =
+        transducer.output_function_[i];
+  }
+
+  std::vector<CUDD::ADD> functions;
+
+  for (const CUDD::BDD& output_function : transducer.output_function_) {
+    functions.push_back(output_function.Add());
+  }
+
+  for (const CUDD::BDD& bit_function : transducer.transition_function_) {
+    functions.push_back(bit_function.VectorCompose(output_substitution).Add());
+  }
+
+  // The inputs of the transducer are the outputs of the variable manager if
+  // the environment is the protagonist
+  LetterClasses letter_classes(var_mgr, std::move(functions));
+  const LetterPartition& letters =
+      transducer.protagonist_player_ == Player::Agent ?
+      letter_classes.input_partition() : letter_classes.output_partition();
+
+  if (letters.class_count() > max_letter_count) {
+    throw std::runtime_error("Error: Too many input letter classes to build a table.");
+  }
+
+  machine.letter_count_ = letters.class_count();
+  std::vector<int> input_indices;
+  std::unordered_map<int, std::int32_t> bits;
+
+  for (std::size_t i = 0; i < input_count; ++i) {
+    int index = var_mgr->name_to_variable(machine.input_labels_[i]).NodeReadIndex();
+    input_indices.push_back(index);
+    bits[index] = i;
+  }
+
+  for (const std::vector<int>& representative : letters.representatives) {
+    std::uint64_t word = 0;
+
+    for (std::size_t i = 0; i < input_count; ++i) {
+      word |= std::uint64_t(representative[input_indices[i]]) << i;
+    }
+
+    machine.representatives_.push_back(word);
+  }
+
+  CUDD::ADD letter_function = mgr->addZero();
+
+  for (std::size_t letter = 0; letter < letters.class_count(); ++letter) {
+    letter_function =
+        letter_function + letters.classes[letter].Add() * mgr->constant(letter);
+  }
+
+  std::unordered_map<DdNode*, std::uint32_t> positions;
+  flatten_letters(letter_function.getNode(), bits, positions,
+                  machine.letter_nodes_);
+
+  TransducerExecutor executor(transducer);
+  std::unordered_map<std::vector<std::uint8_t>, std::uint32_t,
+                     boost::hash<std::vector<std::uint8_t>>> state_ids;
+  std::vector<std::vector<std::uint8_t>> states;
+  std::deque<std::uint32_t> frontier;
+
+  auto discover = [&] (const std::vector<std::uint8_t>& state) {
+    auto inserted = state_ids.emplace(state, states.size());
+
+    if (inserted.second) {
+      states.push_back(state);
+      frontier.push_back(inserted.first->second);
+    }
+
+    return inserted.first->second;
+  };
+
+  discover(executor.state());
+
+  std::vector<std::uint8_t> input(input_count);
+  std::vector<std::uint8_t> output(output_count);
+
+  while (!frontier.empty()) {
+    std::uint32_t id = frontier.front();
+    frontier.pop_front();
+    machine.next_state_.resize((id + 1) * machine.letter_count_);
+    machine.output_.resize((id + 1) * machine.letter_count_);
+
+    for (std::size_t letter = 0; letter < machine.letter_count_; ++letter) {
+      for (std::size_t i = 0; i < input_count; ++i) {
+        input[i] = (machine.representatives_[letter] >> i) & 1;
+      }
+
+      executor.set_state(states[id]);
+      executor.step(input.data(), output.data());
+
+      std::uint64_t output_letter = 0;
+
+      for (std::size_t i = 0; i < output_count; ++i) {
+        output_letter |= std::uint64_t(output[i]) << i;
+      }
+
+      // discover may reallocate states, so the successor is stored first
+      std::uint32_t successor = discover(executor.state());
+      machine.next_state_[id * machine.letter_count_ + letter] = successor;
+      machine.output_[id * machine.letter_count_ + letter] = output_letter;
+    }
+  }
+
+  return machine;
+}
+
+MealyMachine MealyMachine::minimize() const {
+  std::size_t count = state_count();
+  std::vector<std::uint32_t> block(count);
+  std::size_t block_count = 0;
+
+  // Initial partition: states with the same output row
+  {
+    std::map<std::vector<std::uint64_t>, std::uint32_t> rows;
+
+    for (std::size_t s = 0; s < count; ++s) {
+      std::vector<std::uint64_t> row(output_.begin() + s * letter_count_,
+                                     output_.begin() + (s + 1) * letter_count_);
+      block[s] = rows.emplace(std::move(row), rows.size()).first->second;
+    }
+
+    block_count = rows.size();
+  }
+
+  // Refine by the blocks of the successors until no block splits
+  while (true) {
+    std::map<std::vector<std::uint32_t>, std::uint32_t> signatures;
+    std::vector<std::uint32_t> refined(count);
+
+    for (std::size_t s = 0; s < count; ++s) {
+      std::vector<std::uint32_t> signature = {block[s]};
+
+      for (std::size_t letter = 0; letter < letter_count_; ++letter) {
+        signature.push_back(block[next_state_[s * letter_count_ + letter]]);
+      }
+
+      refined[s] =
+          signatures.emplace(std::move(signature), signatures.size()).first->second;
+    }
+
+    block.swap(refined);
+
+    if (signatures.size() == block_count) {
+      break;
+    }
+
+    block_count = signatures.size();
+  }
+
+  // Renumber the blocks so that the block of the initial state comes first
+  std::vector<std::uint32_t> renumbered(block_count, block_count);
+  std::vector<std::size_t> representatives;
+  std::deque<std::size_t> frontier = {0};
+  renumbered[block[0]] = 0;
+  representatives.push_back(0);
+
+  while (!frontier.empty()) {
+    std::size_t s = frontier.front();
+    frontier.pop_front();
+
+    for (std::size_t letter = 0; letter < letter_count_; ++letter) {
+      std::uint32_t successor = next_state_[s * letter_count_ + letter];
+
+      if (renumbered[block[successor]] == block_count) {
+        renumbered[block[successor]] = representatives.size();
+        representatives.push_back(successor);
+        frontier.push_back(successor);
+      }
+    }
+  }
+
+  MealyMachine minimal(input_labels_, output_labels_);
+  minimal.letter_count_ = letter_count_;
+  minimal.letter_nodes_ = letter_nodes_;
+  minimal.representatives_ = representatives_;
+  minimal.next_state_.resize(representatives.size() * letter_count_);
+  minimal.output_.resize(representatives.size() * letter_count_);
+
+  for (std::size_t b = 0; b < representatives.size(); ++b) {
+    std::size_t s = representatives[b];
+
+    for (std::size_t letter = 0; letter < letter_count_; ++letter) {
+      minimal.next_state_[b * letter_count_ + letter] =
+          renumbered[block[next_state_[s * letter_count_ + letter]]];
+      minimal.output_[b * letter_count_ + letter] =
+          output_[s * letter_count_ + letter];
+    }
+  }
+
+  return minimal;
+}
+
+std::uint32_t MealyMachine::step(std::uint32_t state, std::size_t letter,
+                                 std::uint64_t& output) const {
+  output = output_[state * letter_count_ + letter];
+
+  return next_state_[state * letter_count_ + letter];
+}
+
+std::size_t MealyMachine::letter_of(std::uint64_t input) const {
+  std::uint32_t node = 0;
+
+  while (letter_nodes_[node].bit >= 0) {
+    node = ((input >> letter_nodes_[node].bit) & 1) ?
+        letter_nodes_[node].then_node : letter_nodes_[node].else_node;
+  }
+
+  return letter_nodes_[node].then_node;
+}
+
+std::size_t MealyMachine::state_count() const {
+  return next_state_.size() / letter_count_;
+}
+
+std::size_t MealyMachine::letter_count() const {
+  return letter_count_;
+}
+
+void MealyMachine::dump_table(const std::string& filename) const {
+  std::ofstream out(filename);
+
+  if (!out) {
+    throw std::runtime_error("Error: Cannot open " + filename);
+  }
+
+  out << "/* Mealy machine generated by BeSyft. State 0 is initial. */\n"
+      << "#include <stdint.h>\n\n";
+
+  out << "/* Input word bits:";
+  for (std::size_t i = 0; i < input_labels_.size(); ++i) {
+    out << " " << i << "=" << input_labels_[i];
+  }
+  out << " */\n/* Output letter bits:";
+  for (std::size_t i = 0; i < output_labels_.size(); ++i) {
+    out << " " << i << "=" << output_labels_[i];
+  }
+  out << " */\n\n";
+
+  out << "#define BESYFT_STATE_COUNT " << state_count() << "\n"
+      << "#define BESYFT_LETTER_COUNT " << letter_count_ << "\n\n";
+
+  // Decision diagram of the letters, as in letter_of
+  out << "typedef struct { int32_t bit; uint32_t then_node, else_node; } "
+      << "besyft_letter_node;\n\n"
+      << "/* Leaves have bit -1 and hold their letter in then_node. */\n"
+      << "static const besyft_letter_node besyft_letter_nodes[] = {\n";
+
+  for (std::size_t n = 0; n < letter_nodes_.size(); ++n) {
+    out << "  {" << letter_nodes_[n].bit << ", " << letter_nodes_[n].then_node
+        << ", " << letter_nodes_[n].else_node << "}"
+        << (n + 1 == letter_nodes_.size() ? "" : ",") << "\n";
+  }
+
+  out << "};\n\n"
+      << "/* Returns the letter of an input word, whose bit i is input i. */\n"
+      << "static inline uint32_t besyft_letter(uint64_t input) {\n"
+      << "  uint32_t node = 0;\n"
+      << "  while (besyft_letter_nodes[node].bit >= 0) {\n"
+      << "    node = ((input >> besyft_letter_nodes[node].bit) & 1) ?\n"
+      << "        besyft_letter_nodes[node].then_node : "
+      << "besyft_letter_nodes[node].else_node;\n"
+      << "  }\n"
+      << "  return besyft_letter_nodes[node].then_node;\n"
+      << "}\n\n"
+      << "typedef struct { uint32_t next; uint64_t output; } besyft_entry;\n\n"
+      << "static const besyft_entry besyft_mealy[BESYFT_STATE_COUNT]"
+      << "[BESYFT_LETTER_COUNT] = {\n";
+
+  for (std::size_t s = 0; s < state_count(); ++s) {
+    out << "  {";
+
+    for (std::size_t letter = 0; letter < letter_count_; ++letter) {
+      std::size_t entry = s * letter_count_ + letter;
+      out << (letter == 0 ? "" : ", ") << "{" << next_state_[entry] << ", "
+          << output_[entry] << "ull}";
+    }
+
+    out << "}" << (s + 1 == state_count() ? "" : ",") << "\n";
+  }
+
+  out << "};\n";
+}
+
+}
@@ -0,0 +1,178 @@
+#include "OnTheFlyReachabilitySynthesizer.h"
+
+#include <deque>
+#include <unordered_map>
+
+#include "CancellationToken.h"
+
+namespace Syft {
+
+namespace {
+
+enum class Status {Unknown, Winning, Losing};
+
+}
+
+OnTheFlyReachabilitySynthesizer::OnTheFlyReachabilitySynthesizer(
+    ExplicitComponentProduct spec)
+    : Synthesizer<ExplicitComponentProduct>(std::move(spec)) {}
+
+SynthesisResult OnTheFlyReachabilitySynthesizer::run() const {
+  using ProductState = ExplicitComponentProduct::ProductState;
+
+  std::size_t outer_count = spec_.outer_letter_count();
+  std::size_t inner_count = spec_.inner_letter_count();
+
+  // A state wins once enough of its outer choices win, and an outer choice
+  // wins once enough of its inner choices lead to winning states
+  std::size_t outer_needed = spec_.outer_exists() ? 1 : outer_count;
+  std::size_t inner_needed = spec_.outer_exists() ? inner_count : 1;
+
+  std::unordered_map<ProductState, std::size_t,
+                     ExplicitComponentProduct::ProductStateHash> state_ids;
+  std::vector<ProductState> states;
+  std::vector<Status> status;
+  std::vector<bool> expanded, queued;
+  std::vector<std::size_t> state_counters;
+  std::vector<std::vector<std::size_t>> choice_counters;
+  std::vector<std::vector<std::pair<std::size_t, std::size_t>>> dependents;
+
+  std::deque<std::size_t> frontier;
+  std::vector<std::size_t> newly_winning;
+
+  auto discover = [&] (const ProductState& state) {
+    auto inserted = state_ids.emplace(state, states.size());
+
+    if (inserted.second) {
+      states.push_back(state);
+      status.push_back(spec_.is_goal(state) ? Status::Winning : Status::Unknown);
+      expanded.push_back(false);
+      queued.push_back(false);
+      state_counters.push_back(0);
+      choice_counters.emplace_back();
+      dependents.emplace_back();
+    }
+
+    return inserted.first->second;
+  };
+
+  // Called once for each letter class leading from the outer choice of a
+  // state into a winning state
+  auto credit = [&] (std::size_t id, std::size_t outer) {
+    if (status[id] != Status::Unknown || choice_counters[id][outer] == 0) {
+      return;
+    }
+
+    if (--choice_counters[id][outer] == 0 && --state_counters[id] == 0) {
+      status[id] = Status::Winning;
+      newly_winning.push_back(id);
+    }
+  };
+
+  // A state only needs to be expanded if it can still decide a pending choice
+  auto relevant = [&] (std::size_t id) {
+    if (id == 0) {
+      return true;
+    }
+
+    for (const auto& dependent : dependents[id]) {
+      if (status[dependent.first] == Status::Unknown &&
+          choice_counters[dependent.first][dependent.second] != 0) {
+        return true;
+      }
+    }
+
+    return false;
+  };
+
+  auto enqueue = [&] (std::size_t id) {
+    if (!expanded[id] && !queued[id] && status[id] == Status::Unknown) {
+      queued[id] = true;
+      frontier.push_back(id);
+    }
+  };
+
+  enqueue(discover(spec_.initial_state()));
+
+  while (status[0] == Status::Unknown && !frontier.empty()) {
+    CancellationToken::global().check();
+    std::size_t id = frontier.front();
+    frontier.pop_front();
+    queued[id] = false;
+
+    if (status[id] != Status::Unknown || !relevant(id)) {
+      continue;
+    }
+
+    expanded[id] = true;
+    state_counters[id] = outer_needed;
+    choice_counters[id].assign(outer_count, inner_needed);
+
+    for (std::size_t outer = 0; outer < outer_count; ++outer) {
+      for (std::size_t inner = 0;
+           inner < inner_count && status[id] == Status::Unknown; ++inner) {
+        std::size_t successor =
+            discover(spec_.successor(states[id], outer, inner));
+
+        if (status[successor] == Status::Winning) {
+          credit(id, outer);
+        } else {
+          dependents[successor].emplace_back(id, outer);
+          enqueue(successor);
+        }
+      }
+    }
+
+    // Backward propagation of the states won by this expansion
+    while (!newly_winning.empty()) {
+      std::size_t winner = newly_winning.back();
+      newly_winning.pop_back();
+
+      for (const auto& dependent : dependents[winner]) {
+        credit(dependent.first, dependent.second);
+      }
+
+      dependents[winner].clear();
+    }
+  }
+
+  // With the relevant part exhausted, every undecided expanded state is
+  // losing. States that were never expanded stay undecided.
+  if (status[0] == Status::Unknown) {
+    for (std::size_t id = 0; id < states.size(); ++id) {
+      if (expanded[id] && status[id] == Status::Unknown) {
+        status[id] = Status::Losing;
+      }
+    }
+  }
+
+  discovered_state_count_ = states.size();
+  expanded_state_count_ = 0;
+
+  std::vector<ProductState> winning_states;
+
+  for (std::size_t id = 0; id < states.size(); ++id) {
+    expanded_state_count_ += expanded[id];
+
+    if (status[id] == Status::Winning) {
+      winning_states.push_back(states[id]);
+    }
+  }
+
+  SynthesisResult result;
+  result.realizability = (status[0] == Status::Winning);
+  result.winning_states = spec_.product_states_to_bdd(winning_states);
+  result.transducer = nullptr;
+
+  return result;
+}
+
+std::size_t OnTheFlyReachabilitySynthesizer::discovered_state_count() const {
+  return discovered_state_count_;
+}
+
+std::size_t OnTheFlyReachabilitySynthesizer::expanded_state_count() const {
+  return expanded_state_count_;
+}
+
+}
@@ -55,4 +55,33 @@ CUDD::BDD ExistsForall::apply(const CUDD::BDD& bdd) const {
     return exists_.apply(forall_.apply(bdd));
 }
 
+GameQuantifiers game_quantifiers(const CUDD::BDD& input_cube,
+                                 const CUDD::BDD& output_cube,
+                                 Player starting_player,
+                                 Player protagonist_player) {
+  GameQuantifiers quantifiers;
+
+  if (starting_player == Player::Environment) {
+      if (protagonist_player == Player::Environment) {
+          quantifiers.independent_variables = std::make_unique<Forall>(output_cube);
+          quantifiers.non_state_variables = std::make_unique<Exists>(input_cube);
+      } else {
+          quantifiers.independent_variables = std::make_unique<NoQuantification>();
+          quantifiers.non_state_variables = std::make_unique<ForallExists>(input_cube,
+                                                                           output_cube);
+      }
+  } else { // i.e. starting_player == Player::Agent
+      if (protagonist_player == Player::Environment) {
+          quantifiers.independent_variables = std::make_unique<NoQuantification>();
+          quantifiers.non_state_variables = std::make_unique<ForallExists>(output_cube,
+                                                                           input_cube);
+      } else { // i.e. protagonist_player == Player::Agent
+          quantifiers.independent_variables = std::make_unique<Forall>(input_cube);
+          quantifiers.non_state_variables = std::make_unique<Exists>(output_cube);
+      }
+  }
+
+  return quantifiers;
+}
+
 }
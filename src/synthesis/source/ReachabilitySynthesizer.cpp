@@ -1,14 +1,29 @@
 #include "ReachabilitySynthesizer.h"
 
 #include <cassert>
+#include <utility>
+
+#include "CancellationToken.h"
 
 namespace Syft {
 
 ReachabilitySynthesizer::ReachabilitySynthesizer(SymbolicStateDfa spec,
 						 Player starting_player, Player protagonist_player,
 						 CUDD::BDD goal_states,
-						 CUDD::BDD state_space)
-    : DfaGameSynthesizer(spec, starting_player, protagonist_player)
+						 CUDD::BDD state_space,
+						 StrategyExtractionOptions extraction_options)
+    : DfaGameSynthesizer(spec, starting_player, protagonist_player, extraction_options)
+    , goal_states_(goal_states), state_space_(state_space)
+{}
+
+ReachabilitySynthesizer::ReachabilitySynthesizer(SymbolicStateDfa spec,
+						 Player starting_player, Player protagonist_player,
+						 CUDD::BDD goal_states,
+						 CUDD::BDD state_space,
+						 std::vector<CUDD::BDD> transition_vector,
+						 StrategyExtractionOptions extraction_options)
+    : DfaGameSynthesizer(spec, starting_player, protagonist_player,
+                         std::move(transition_vector), extraction_options)
     , goal_states_(goal_states), state_space_(state_space)
 {}
 
@@ -19,6 +34,8 @@ SynthesisResult ReachabilitySynthesizer::run() const {
   CUDD::BDD winning_moves = winning_states;
 
   while (true) {
+    CancellationToken::global().check();
+
     CUDD::BDD new_winning_moves = winning_moves |
                                   (state_space_ & (!winning_states) & preimage(winning_states));
 
@@ -27,24 +44,14 @@ SynthesisResult ReachabilitySynthesizer::run() const {
     if (includes_initial_state(new_winning_states)) {
         result.realizability = true;
         result.winning_states = new_winning_states;
-        std::unordered_map<int, CUDD::BDD> strategy = synthesize_strategy(
-              new_winning_moves);
-
-        result.transducer = std::make_unique<Transducer>(
-              var_mgr_, initial_vector_, strategy, spec_.transition_function(),
-              starting_player_, protagonist_player_);
+        attach_strategy(result, new_winning_moves);
         return result;
 
     } else if (new_winning_states == winning_states) {
         result.realizability = false;
         result.winning_states = new_winning_states;
         // result.transducer = nullptr;
-        std::unordered_map<int, CUDD::BDD> strategy = synthesize_strategy(
-              new_winning_moves);
-
-        result.transducer = std::make_unique<Transducer>(
-              var_mgr_, initial_vector_, strategy, spec_.transition_function(),
-              starting_player_, protagonist_player_);
+        attach_strategy(result, new_winning_moves);
         return result;
     }
 
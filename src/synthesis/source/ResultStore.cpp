@@ -0,0 +1,278 @@
+#include "ResultStore.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Syft {
+
+namespace {
+
+// Separates the fields of a key. Formulas cannot contain it
+const char key_separator = '\x1f';
+
+// Whitespace may separate tokens, as in "F a", so it is collapsed rather
+// than removed
+std::string collapsed_whitespace(const std::string& formula) {
+  std::string result;
+  bool pending_space = false;
+
+  for (char c : formula) {
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      pending_space = !result.empty();
+    } else {
+      if (pending_space) {
+        result.push_back(' ');
+        pending_space = false;
+      }
+
+      result.push_back(c);
+    }
+  }
+
+  return result;
+}
+
+std::string sorted_names(std::vector<std::string> names) {
+  std::sort(names.begin(), names.end());
+  std::string result;
+
+  for (const std::string& name : names) {
+    result += name + ",";
+  }
+
+  return result;
+}
+
+std::uint64_t file_size(const std::string& filename) {
+  struct stat status;
+
+  if (stat(filename.c_str(), &status) != 0) {
+    return 0;
+  }
+
+  return status.st_size;
+}
+
+}
+
+ResultStore::ResultStore(const std::string& data_file)
+    : data_file_(data_file)
+    , index_file_(data_file + ".idx")
+    , index_fd_(-1)
+    , entries_(nullptr)
+    , entry_count_(0)
+    , record_count_(0) {
+  std::ofstream create(data_file_, std::ios::app | std::ios::binary);
+
+  if (!create) {
+    throw std::runtime_error("Error: cannot open result store " + data_file_);
+  }
+
+  create.close();
+  map_index();
+
+  std::uint64_t data_size = file_size(data_file_);
+  bool consistent = file_size(index_file_) % sizeof(IndexEntry) == 0 &&
+      (entry_count_ == 0 ? data_size == 0
+                         : entries_[entry_count_ - 1].offset < data_size);
+
+  if (!consistent) {
+    rebuild_index();
+  }
+
+  for (std::size_t i = 0; i < entry_count_; ++i) {
+    offsets_[entries_[i].hash].push_back(entries_[i].offset);
+  }
+
+  record_count_ = entry_count_;
+}
+
+ResultStore::~ResultStore() {
+  unmap_index();
+}
+
+std::uint64_t ResultStore::hash(const std::string& key) {
+  // 64-bit FNV-1a
+  std::uint64_t result = 14695981039346656037ULL;
+
+  for (char c : key) {
+    result ^= static_cast<unsigned char>(c);
+    result *= 1099511628211ULL;
+  }
+
+  return result;
+}
+
+void ResultStore::map_index() {
+  unmap_index();
+  index_fd_ = open(index_file_.c_str(), O_RDONLY);
+
+  if (index_fd_ < 0) {
+    return;
+  }
+
+  struct stat status;
+
+  if (fstat(index_fd_, &status) != 0) {
+    throw std::runtime_error("Error: cannot read result index " + index_file_);
+  }
+
+  entry_count_ = status.st_size / sizeof(IndexEntry);
+
+  if (entry_count_ == 0) {
+    return;
+  }
+
+  void* mapping = mmap(nullptr, entry_count_ * sizeof(IndexEntry), PROT_READ,
+                       MAP_SHARED, index_fd_, 0);
+
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error("Error: cannot map result index " + index_file_);
+  }
+
+  entries_ = static_cast<const IndexEntry*>(mapping);
+}
+
+void ResultStore::unmap_index() {
+  if (entries_ != nullptr) {
+    munmap(const_cast<IndexEntry*>(entries_), entry_count_ * sizeof(IndexEntry));
+  }
+
+  if (index_fd_ >= 0) {
+    close(index_fd_);
+  }
+
+  index_fd_ = -1;
+  entries_ = nullptr;
+  entry_count_ = 0;
+}
+
+void ResultStore::rebuild_index() {
+  unmap_index();
+
+  std::ifstream data(data_file_, std::ios::binary);
+  std::ofstream index(index_file_, std::ios::trunc | std::ios::binary);
+  std::string line;
+  std::uint64_t offset = 0;
+
+  while (std::getline(data, line)) {
+    // A record cut short by a crash has no line end and is skipped
+    if (data.eof()) {
+      break;
+    }
+
+    IndexEntry entry = {hash(line.substr(0, line.find('\t'))), offset};
+    index.write(reinterpret_cast<const char*>(&entry), sizeof(IndexEntry));
+    offset += line.size() + 1;
+  }
+
+  index.close();
+  map_index();
+}
+
+std::string ResultStore::make_key(const std::string& agent_specification,
+                                  const std::string& environment_assumption,
+                                  const InputOutputPartition& partition,
+                                  Player starting_player,
+                                  int algorithm,
+                                  const std::string& version) {
+  std::ostringstream key;
+  key << version << key_separator
+      << (starting_player == Player::Agent ? "Agent" : "Environment")
+      << key_separator << algorithm << key_separator
+      << sorted_names(partition.input_variables) << key_separator
+      << sorted_names(partition.output_variables) << key_separator
+      << collapsed_whitespace(agent_specification) << key_separator
+      << collapsed_whitespace(environment_assumption);
+
+  return key.str();
+}
+
+bool ResultStore::lookup(const std::string& key, StoredResult& result) const {
+  auto found = offsets_.find(hash(key));
+
+  if (found == offsets_.end()) {
+    return false;
+  }
+
+  const std::vector<std::uint64_t>& offsets = found->second;
+  std::ifstream data(data_file_, std::ios::binary);
+
+  // Latest records first, so that they shadow older ones
+  for (std::size_t i = offsets.size(); i-- > 0;) {
+    data.clear();
+    data.seekg(offsets[i]);
+    std::string line;
+
+    if (!std::getline(data, line)) {
+      continue;
+    }
+
+    std::istringstream record(line);
+    std::string record_key, times;
+    std::getline(record, record_key, '\t');
+
+    // Hashes may collide
+    if (record_key != key) {
+      continue;
+    }
+
+    std::getline(record, result.algorithm, '\t');
+    std::getline(record, result.verdict, '\t');
+    std::getline(record, times);
+    std::istringstream time_stream(times);
+    double time;
+    result.run_times.clear();
+
+    while (time_stream >> time) {
+      result.run_times.push_back(time);
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+void ResultStore::insert(const std::string& key, const StoredResult& result) {
+  std::ostringstream record;
+  record << key << '\t' << result.algorithm << '\t' << result.verdict << '\t';
+
+  for (double time : result.run_times) {
+    record << time << " ";
+  }
+
+  record << '\n';
+
+  IndexEntry entry = {hash(key), file_size(data_file_)};
+
+  // The data is written first, so that the index never points past it
+  std::ofstream data(data_file_, std::ios::app | std::ios::binary);
+  data << record.str();
+  data.close();
+
+  if (!data) {
+    throw std::runtime_error("Error: cannot write result store " + data_file_);
+  }
+
+  std::ofstream index(index_file_, std::ios::app | std::ios::binary);
+  index.write(reinterpret_cast<const char*>(&entry), sizeof(IndexEntry));
+  index.close();
+
+  offsets_[entry.hash].push_back(entry.offset);
+  ++record_count_;
+}
+
+std::size_t ResultStore::size() const {
+  return record_count_;
+}
+
+}
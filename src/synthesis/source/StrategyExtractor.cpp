@@ -0,0 +1,434 @@
+#include "StrategyExtractor.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "CancellationToken.h"
+#include "Stopwatch.h"
+
+namespace Syft {
+
+namespace {
+
+struct NodeBudget {
+  DdManager* manager;
+  unsigned int max_keys;
+};
+
+// Termination callback polled by CUDD while building new nodes. Replaces the
+// one of VarMgr::watch_cancellation while it is registered, so it polls
+// cancellation too.
+int exceeds_node_budget(const void* arg) {
+  const NodeBudget* budget = static_cast<const NodeBudget*>(arg);
+
+  return Cudd_ReadKeys(budget->manager) > budget->max_keys ||
+      CancellationToken::global().poll();
+}
+
+}
+
+StrategyExtractor::StrategyExtractor(std::shared_ptr<VarMgr> var_mgr,
+                                     Player protagonist_player,
+                                     StrategyExtractionOptions options)
+    : var_mgr_(std::move(var_mgr))
+    , protagonist_player_(protagonist_player)
+    , options_(options)
+{}
+
+std::vector<std::string> StrategyExtractor::controlled_variable_labels() const {
+  if (protagonist_player_ == Player::Environment) {
+    return var_mgr_->input_variable_labels();
+  } else {
+    return var_mgr_->output_variable_labels();
+  }
+}
+
+CUDD::BDD StrategyExtractor::variable_cube(const std::vector<int>& indices) const {
+  std::shared_ptr<CUDD::Cudd> mgr = var_mgr_->cudd_mgr();
+  CUDD::BDD cube = mgr->bddOne();
+
+  for (int index : indices) {
+    cube &= mgr->bddVar(index);
+  }
+
+  return cube;
+}
+
+std::vector<int> StrategyExtractor::controlled_indices() const {
+  std::vector<int> indices;
+
+  for (const std::string& label : controlled_variable_labels()) {
+    indices.push_back(var_mgr_->name_to_variable(label).NodeReadIndex());
+  }
+
+  return indices;
+}
+
+std::unordered_map<int, CUDD::BDD> StrategyExtractor::extract(
+    const CUDD::BDD& winning_moves) const {
+  std::vector<int> outputs = controlled_indices();
+
+  if (!options_.decompose || outputs.size() < 2) {
+    return extract_cluster(winning_moves, outputs);
+  }
+
+  std::vector<std::vector<int>> clusters =
+      independent_clusters(winning_moves, outputs);
+
+  if (options_.report_times) {
+    std::cout << std::endl << "[BeSyft] Found " << clusters.size()
+              << " independent output cluster(s)" << std::endl;
+  }
+
+  if (clusters.size() == 1) {
+    return extract_cluster(winning_moves, outputs);
+  }
+
+  // Clusters share the CUDD manager, which is not thread-safe, so they are
+  // extracted one after the other
+  std::unordered_map<int, CUDD::BDD> output_function;
+  CUDD::BDD all_outputs = variable_cube(outputs);
+
+  for (const std::vector<int>& cluster : clusters) {
+    CUDD::BDD cluster_cube = variable_cube(cluster);
+    CUDD::BDD cluster_moves =
+        winning_moves.ExistAbstract(all_outputs.Cofactor(cluster_cube));
+    std::unordered_map<int, CUDD::BDD> cluster_function =
+        extract_cluster(cluster_moves, cluster);
+    output_function.insert(cluster_function.begin(), cluster_function.end());
+  }
+
+  return output_function;
+}
+
+std::vector<std::vector<int>> StrategyExtractor::independent_clusters(
+    const CUDD::BDD& winning_moves,
+    const std::vector<int>& outputs) const {
+  std::unordered_map<int, std::set<int>> neighbors =
+      interaction_graph(winning_moves, outputs);
+  std::vector<std::vector<int>> clusters;
+  std::set<int> visited;
+
+  for (int output : outputs) {
+    if (!visited.insert(output).second) {
+      continue;
+    }
+
+    std::vector<int> cluster = {output};
+
+    for (std::size_t i = 0; i < cluster.size(); ++i) {
+      for (int neighbor : neighbors[cluster[i]]) {
+        if (visited.insert(neighbor).second) {
+          cluster.push_back(neighbor);
+        }
+      }
+    }
+
+    clusters.push_back(std::move(cluster));
+  }
+
+  if (clusters.size() == 1) {
+    return clusters;
+  }
+
+  // Disconnected clusters can still be correlated, as in y_1 XOR y_2, so the
+  // decomposition is only kept if the winning moves are the conjunction of
+  // their projections on the clusters
+  CUDD::BDD all_outputs = variable_cube(outputs);
+  CUDD::BDD conjunction = var_mgr_->cudd_mgr()->bddOne();
+
+  for (const std::vector<int>& cluster : clusters) {
+    conjunction &= winning_moves.ExistAbstract(
+        all_outputs.Cofactor(variable_cube(cluster)));
+  }
+
+  if (conjunction != winning_moves) {
+    return {outputs};
+  }
+
+  return clusters;
+}
+
+std::unordered_map<int, CUDD::BDD> StrategyExtractor::extract_cluster(
+    const CUDD::BDD& winning_moves,
+    const std::vector<int>& outputs) const {
+  if (options_.mode == StrategyExtractionMode::Skolem) {
+    return extract_skolem(winning_moves, outputs);
+  } else if (options_.node_budget == 0) {
+    return extract_solve_eqn(winning_moves, outputs);
+  }
+
+  DdManager* manager = var_mgr_->cudd_mgr()->getManager();
+  NodeBudget budget{manager,
+                    Cudd_ReadKeys(manager) +
+                        static_cast<unsigned int>(options_.node_budget)};
+  Cudd_RegisterTerminationCallback(manager, exceeds_node_budget, &budget);
+
+  std::unordered_map<int, CUDD::BDD> output_function;
+
+  try {
+    output_function = extract_solve_eqn(winning_moves, outputs);
+  } catch (const SynthesisTimeout&) {
+    var_mgr_->watch_cancellation();
+    throw;
+  } catch (const std::logic_error&) {
+    // The CUDD error handler throws when an operation is terminated
+    var_mgr_->watch_cancellation();
+
+    if (Cudd_ReadErrorCode(manager) != CUDD_TERMINATION) {
+      throw;
+    }
+
+    Cudd_ClearErrorCode(manager);
+
+    if (options_.report_times) {
+      std::cout << std::endl << "[BeSyft] SolveEqn exceeded "
+                << options_.node_budget
+                << " new nodes, falling back to Skolem extraction" << std::endl;
+    }
+
+    return extract_skolem(winning_moves, outputs);
+  }
+
+  var_mgr_->watch_cancellation();
+
+  return output_function;
+}
+
+std::unordered_map<int, CUDD::BDD> StrategyExtractor::extract_solve_eqn(
+    const CUDD::BDD& winning_moves,
+    const std::vector<int>& outputs) const {
+  std::unordered_map<int, CUDD::BDD> output_function;
+  std::size_t output_count = outputs.size();
+
+  if (output_count == 0) {
+    return output_function;
+  }
+
+  std::vector<CUDD::BDD> parameterized_output_function;
+  int* output_indices;
+
+  Stopwatch solve_eqn;
+  solve_eqn.start();
+
+  // Need to negate the BDD because b.SolveEqn(...) solves the equation b = 0
+  CUDD::BDD pre = (!winning_moves).SolveEqn(variable_cube(outputs),
+                                            parameterized_output_function,
+                                            &output_indices,
+                                            output_count);
+
+  std::vector<int> index_copy(output_indices, output_indices + output_count);
+
+  if (options_.verify) {
+    // Also frees output_indices
+    CUDD::BDD verified = (!winning_moves).VerifySol(parameterized_output_function,
+                                                    output_indices);
+
+    if (pre != verified) {
+      throw std::runtime_error("Error: SolveEqn returned an incorrect solution.");
+    }
+  } else {
+    // Allocated by CUDD with malloc
+    std::free(output_indices);
+  }
+
+  double t_solve_eqn = solve_eqn.stop().count() / 1000.0;
+
+  if (options_.report_times) {
+    std::cout << std::endl << "[BeSyft] SolveEqn DONE in " << t_solve_eqn << " s" << std::endl;
+  }
+
+  // Let y_i be the i-th output variable in the BDD ordering. The parameterized
+  // output function for y_i is of the form f_i(x_1, ..., x_m, p_i, ..., p_n)
+  // where p_i, ..., p_n are parameters taking the place of y_i, ..., y_n. All
+  // f_i are such that no matter what we replace p_i, ..., p_n with, the result
+  // is a valid output function. All parameters are replaced with 1 by a single
+  // composition, so that all f_i only depend on the input and state variables.
+  std::shared_ptr<CUDD::Cudd> mgr = var_mgr_->cudd_mgr();
+  std::vector<CUDD::BDD> parameter_values;
+
+  for (std::size_t i = 0; i < var_mgr_->total_variable_count(); ++i) {
+    parameter_values.push_back(mgr->bddVar(i));
+  }
+
+  for (int parameter_index : index_copy) {
+    parameter_values[parameter_index] = mgr->bddOne();
+  }
+
+  for (std::size_t i = 0; i < output_count; ++i) {
+    Stopwatch substitution;
+    substitution.start();
+
+    output_function[index_copy[i]] =
+        parameterized_output_function[i].VectorCompose(parameter_values);
+
+    double t_substitution = substitution.stop().count() / 1000.0;
+
+    if (options_.report_times) {
+      std::cout << "[BeSyft] Output function of "
+                << var_mgr_->index_to_name(index_copy[i]) << " DONE in "
+                << t_substitution << " s" << std::endl;
+    }
+  }
+
+  return output_function;
+}
+
+std::unordered_map<int, std::set<int>> StrategyExtractor::interaction_graph(
+    const CUDD::BDD& winning_moves,
+    const std::vector<int>& outputs) const {
+  std::shared_ptr<CUDD::Cudd> mgr = var_mgr_->cudd_mgr();
+  std::unordered_map<int, std::set<int>> neighbors;
+  std::set<int> is_output(outputs.begin(), outputs.end());
+
+  for (int output : outputs) {
+    neighbors[output];
+  }
+
+  for (int output : outputs) {
+    CUDD::BDD difference = winning_moves.Compose(mgr->bddOne(), output) ^
+        winning_moves.Compose(mgr->bddZero(), output);
+
+    for (unsigned int index : difference.SupportIndices()) {
+      int other = static_cast<int>(index);
+
+      if (other != output && is_output.count(other) > 0) {
+        neighbors[output].insert(other);
+        neighbors[other].insert(output);
+      }
+    }
+  }
+
+  return neighbors;
+}
+
+std::vector<int> StrategyExtractor::skolem_order(
+    const CUDD::BDD& winning_moves,
+    const std::vector<int>& outputs) const {
+  std::unordered_map<int, std::set<int>> neighbors =
+      interaction_graph(winning_moves, outputs);
+  std::vector<int> elimination_order;
+
+  // Min-degree elimination: an eliminated variable connects its neighbors,
+  // like the existential abstraction of it does in the winning moves
+  while (!neighbors.empty()) {
+    auto next = std::min_element(
+        neighbors.begin(), neighbors.end(),
+        [] (const std::pair<const int, std::set<int>>& a,
+            const std::pair<const int, std::set<int>>& b) {
+          return a.second.size() < b.second.size() ||
+              (a.second.size() == b.second.size() && a.first < b.first);
+        });
+    int variable = next->first;
+    std::set<int> adjacent = std::move(next->second);
+    neighbors.erase(next);
+
+    for (int a : adjacent) {
+      neighbors[a].erase(variable);
+
+      for (int b : adjacent) {
+        if (a != b) {
+          neighbors[a].insert(b);
+        }
+      }
+    }
+
+    elimination_order.push_back(variable);
+  }
+
+  // Output functions are extracted in the reverse order of elimination
+  std::reverse(elimination_order.begin(), elimination_order.end());
+
+  return elimination_order;
+}
+
+std::unordered_map<int, CUDD::BDD> StrategyExtractor::extract_skolem(
+    const CUDD::BDD& winning_moves,
+    const std::vector<int>& outputs) const {
+  std::unordered_map<int, CUDD::BDD> output_function;
+
+  if (outputs.empty()) {
+    return output_function;
+  }
+
+  std::shared_ptr<CUDD::Cudd> mgr = var_mgr_->cudd_mgr();
+
+  Stopwatch quantification;
+  quantification.start();
+
+  // order[i] is quantified out of projections[i + 1] to obtain projections[i],
+  // so projections[i] only depends on order[0], ..., order[i - 1]
+  std::vector<int> order = skolem_order(winning_moves, outputs);
+  std::vector<CUDD::BDD> projections(order.size() + 1);
+  projections[order.size()] = winning_moves;
+
+  for (std::size_t i = order.size(); i > 0; --i) {
+    projections[i - 1] = projections[i].ExistAbstract(mgr->bddVar(order[i - 1]));
+  }
+
+  double t_quantification = quantification.stop().count() / 1000.0;
+
+  if (options_.report_times) {
+    std::cout << std::endl << "[BeSyft] Output quantification DONE in "
+              << t_quantification << " s" << std::endl;
+  }
+
+  // The function of order[i] sets it to 1 whenever that keeps projections[i + 1]
+  // satisfiable, once the outputs before it are replaced by their functions
+  std::vector<CUDD::BDD> substitution;
+
+  for (std::size_t i = 0; i < var_mgr_->total_variable_count(); ++i) {
+    substitution.push_back(mgr->bddVar(i));
+  }
+
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    Stopwatch cofactoring;
+    cofactoring.start();
+
+    CUDD::BDD positive_cofactor =
+        projections[i + 1].Compose(mgr->bddOne(), order[i]);
+    CUDD::BDD function = positive_cofactor.VectorCompose(substitution);
+    substitution[order[i]] = function;
+    output_function[order[i]] = function;
+
+    double t_cofactoring = cofactoring.stop().count() / 1000.0;
+
+    if (options_.report_times) {
+      std::cout << "[BeSyft] Output function of "
+                << var_mgr_->index_to_name(order[i]) << " DONE in "
+                << t_cofactoring << " s" << std::endl;
+    }
+  }
+
+  if (options_.verify) {
+    CUDD::BDD realizable = projections[0];
+    CUDD::BDD achieved = winning_moves.VectorCompose(substitution);
+
+    if (!((!realizable) | achieved).IsOne()) {
+      throw std::runtime_error("Error: Skolem extraction returned an incorrect solution.");
+    }
+  }
+
+  return output_function;
+}
+
+void StrategyExtractor::attach_strategy(SynthesisResult& result,
+                                        const SymbolicStateDfa& arena,
+                                        Player starting_player,
+                                        const CUDD::BDD& winning_moves) const {
+  if (options_.lazy) {
+    result.strategy_oracle = std::make_unique<LazyStrategyOracle>(
+        var_mgr_, arena.automaton_id(), winning_moves, arena.initial_state(),
+        protagonist_player_);
+  } else {
+    std::vector<int> initial_vector = var_mgr_->make_eval_vector(
+        arena.automaton_id(), arena.initial_state());
+    result.transducer = std::make_unique<Transducer>(
+        var_mgr_, arena.automaton_id(), initial_vector, extract(winning_moves),
+        arena.transition_function(), starting_player, protagonist_player_);
+  }
+}
+
+}
@@ -4,6 +4,7 @@
 */
 
 #include "SymbolicCompositionalBestEffortSynthesizer.h"
+#include "CancellationToken.h"
 #include <boost/algorithm/string.hpp>
 #include <queue>
 
@@ -14,12 +15,16 @@ namespace Syft
                                                  std::string agent_specification,
                                                  std::string environment_specification,
                                                  InputOutputPartition partition,
-                                                 Player starting_player)    :   var_mgr_(var_mgr),
+                                                 Player starting_player,
+                                                 StrategyExtractionOptions extraction_options)    :   var_mgr_(var_mgr),
                                                                                 agent_specification_(agent_specification),
                                                                                 environment_specification_(environment_specification),
                                                                                 partition_(partition),
-                                                                                starting_player_(starting_player)
+                                                                                starting_player_(starting_player),
+                                                                                extraction_options_(extraction_options)
     {
+        RunningTimesScope running_times_scope(running_times_);
+
         // 1. Step 1. Construct symbolic DFAs formulas {E -> phi, !E, E && phi}
         // Build MONA DFAs for agent and environment specifications
         Syft::Stopwatch ltlf2dfa;
@@ -96,8 +101,24 @@ namespace Syft
         std::cout << "[BeSyft] Symbolic DFA construction DONE in " << t_dfa2sym << " s" << std::endl;
     }
 
-    std::pair<SynthesisResult, SynthesisResult> SymbolicCompositionalBestEffortSynthesizer::run() {
+    SymbolicCompositionalBestEffortSynthesizer::SymbolicCompositionalBestEffortSynthesizer(std::shared_ptr<VarMgr> var_mgr,
+                                                 SymbolicStateDfa agent_dfa,
+                                                 SymbolicStateDfa environment_dfa,
+                                                 SymbolicStateDfa tautology_dfa,
+                                                 Player starting_player,
+                                                 StrategyExtractionOptions extraction_options)    :   var_mgr_(var_mgr),
+                                                                                starting_player_(starting_player),
+                                                                                extraction_options_(extraction_options)
+    {
+        // Same layout as above: f_{phi} in symbolic_dfas_[0], f_{E} in symbolic_dfas_[1]
+        symbolic_dfas_.push_back(std::move(agent_dfa));
+        symbolic_dfas_.push_back(std::move(environment_dfa));
+        symbolic_dfas_.push_back(std::move(tautology_dfa));
 
+        arena_.push_back(SymbolicStateDfa::product(symbolic_dfas_));
+    }
+
+    std::pair<SynthesisResult, SynthesisResult> SymbolicCompositionalBestEffortSynthesizer::solve(Player starting_player) {
         std::pair<SynthesisResult, SynthesisResult> best_effort_result;
 
         CUDD::BDD adv_goal = ((!symbolic_dfas_[1].final_states()) + symbolic_dfas_[0].final_states()) * (!arena_[0].initial_state_bdd()); // f_{E} -> f_{Phi}
@@ -105,80 +126,111 @@ namespace Syft
         CUDD::BDD neg_goal = ((!symbolic_dfas_[1].final_states()) * (!arena_[0].initial_state_bdd())); // ! f_{E}
         CUDD::BDD coop_goal = (symbolic_dfas_[1].final_states()) * (symbolic_dfas_[0].final_states()) * (!arena_[0].initial_state_bdd()); // F{E} /\ f_{Phi}
 
+        if (arena_transition_vector_.empty()) {
+            arena_transition_vector_ = var_mgr_->make_compose_vector(arena_[0].automaton_id(), arena_[0].transition_function());
+        }
+
         // Step 3. Compute a winning strategy in the adversarial game
         Stopwatch advGame;
         advGame.start();
         std::cout << "[BeSyft] Constructing and solving adversarial game...";
         ReachabilitySynthesizer adv_synthesizer(arena_[0],
-                                                starting_player_,
+                                                starting_player,
                                                 Player::Agent,
                                                 adv_goal, // Lifting
-                                                var_mgr_->cudd_mgr()->bddOne());
+                                                has_bounds_ ? bounds_.adversarial : var_mgr_->cudd_mgr()->bddOne(),
+                                                arena_transition_vector_,
+                                                extraction_options_);
         best_effort_result.first = adv_synthesizer.run();
         double t_advGame = advGame.stop().count() / 1000.0;
         running_times_.push_back(t_advGame);
         std::cout << "DONE in " << t_advGame << " s" << std::endl;
 
+        anytime_options_.report(BestEffortPhase::Adversarial, best_effort_result.first, t_advGame);
+
+        if (anytime_options_.skip_cooperative_if_winning && best_effort_result.first.realizability) {
+            std::cout << "[BeSyft] Adversarially realizable, cooperative game skipped" << std::endl;
+            best_effort_result.second = AnytimeOptions::cooperative_from_adversarial(best_effort_result.first);
+            return best_effort_result;
+        }
+
         // Step 4. Compute environment's winning region in negation of environment game
         Stopwatch coopGame;
         coopGame.start();
         std::cout << "[BeSyft] Constructing and solving cooperative game...";
-        ReachabilitySynthesizer neg_env_synthesizer(arena_[0],
-                                                    starting_player_,
-                                                    Player::Agent,  // gets env winning region from agent's
-                                                    neg_goal, // Lifting
-                                                    var_mgr_->cudd_mgr()->bddOne());
-        SynthesisResult env_result = neg_env_synthesizer.run();
-        CUDD::BDD non_environment_winning_region = env_result.winning_states;
+        if (has_bounds_ && bounds_.reuse_non_environment) {
+            // The negated-environment game does not depend on the agent goal
+            non_environment_winning_region_ = bounds_.non_environment;
+        } else {
+            ReachabilitySynthesizer neg_env_synthesizer(arena_[0],
+                                                        starting_player,
+                                                        Player::Agent,  // gets env winning region from agent's
+                                                        neg_goal, // Lifting
+                                                        var_mgr_->cudd_mgr()->bddOne(),
+                                                        arena_transition_vector_,
+                                                        extraction_options_);
+            SynthesisResult env_result = neg_env_synthesizer.run();
+            non_environment_winning_region_ = env_result.winning_states;
+        }
+        CUDD::BDD non_environment_winning_region = non_environment_winning_region_;
 
         // Step 5. Restrict arena to environemt winning region.
         // i.e. all states that are in non_environment_winning_region have to be pruned as invalid
+        arena_.erase(arena_.begin() + 1, arena_.end()); // drops the restriction of a previous solve
         arena_.push_back(arena_[0].restriction(non_environment_winning_region));
 
         // Step 6. Compute a cooperatively winning strategy in restricted game
         CoOperativeReachabilitySynthesizer coop_synthesizer(arena_[1],
-                                                            starting_player_,
+                                                            starting_player,
                                                             Player::Agent,
                                                             coop_goal, // Lifting
-                                                            var_mgr_->cudd_mgr()->bddOne()); 
+                                                            has_bounds_ ? bounds_.cooperative : var_mgr_->cudd_mgr()->bddOne(),
+                                                            extraction_options_); 
         best_effort_result.second = coop_synthesizer.run();
         double t_coopGame = coopGame.stop().count() / 1000.0;
         running_times_.push_back(t_coopGame);
         std::cout << "DONE in " << t_coopGame << " s" << std::endl; 
+        anytime_options_.report(BestEffortPhase::Cooperative, best_effort_result.second, t_coopGame);
 
         return best_effort_result;
     }
 
-    void SymbolicCompositionalBestEffortSynthesizer::merge_and_dump_dot(const SynthesisResult& adversarial_result, const SynthesisResult& cooperative_result, const string& filename) const {
-        
-        Syft::Stopwatch merge;
-        merge.start();
-        std::cout << "[BeSyft] Merging strategies...";
-
-        std::vector<std::string> output_labels = var_mgr_->output_variable_labels(); // i.e. Y variables
-
-        std::size_t output_count = cooperative_result.transducer.get()->output_function_.size();
-        std::vector<CUDD::ADD> output_vector(output_count);
-
-        // Cooperatively only winning states, i.e. states in cooperatively, but not reactively, winning region
-        CUDD::BDD cooperative_only_winning_states = (!adversarial_result.winning_states) * cooperative_result.winning_states;
-        for(std::size_t i=0; i < output_count; ++i) {
-            std::string label = output_labels[i];
-            int index = var_mgr_->name_to_variable(label).NodeReadIndex();
-            // i. For winning states use adversarial output function
-            CUDD::BDD restricted_adversarial_bdd = 
-                adversarial_result.transducer.get()->output_function_.at(index) * adversarial_result.winning_states; 
-            // ii. For cooperatively only winning states use cooperative output function
-            CUDD::BDD restricted_cooperative_bdd = 
-                cooperative_result.transducer.get()->output_function_.at(index) * cooperative_only_winning_states; 
-            /// iii. For any state keep best-effort output
-            CUDD::BDD merged_bdd = restricted_adversarial_bdd + restricted_cooperative_bdd;
-            output_vector[i] = merged_bdd.Add();
-        }
-        var_mgr_->dump_dot(output_vector, output_labels, filename);
+    std::pair<SynthesisResult, SynthesisResult> SymbolicCompositionalBestEffortSynthesizer::run() {
+        RunningTimesScope running_times_scope(running_times_);
+
+        return solve(starting_player_);
+    }
+
+    std::pair<SynthesisResult, SynthesisResult> SymbolicCompositionalBestEffortSynthesizer::run(Player starting_player) {
+        RunningTimesScope running_times_scope(running_times_);
+
+        // Only the quantifier order of the games depends on the starting
+        // player, so every solve uses the same DFAs and arena
+        return solve(starting_player);
+    }
+
+    void SymbolicCompositionalBestEffortSynthesizer::set_anytime_options(AnytimeOptions anytime_options) {
+        anytime_options_ = std::move(anytime_options);
+    }
+
+    void SymbolicCompositionalBestEffortSynthesizer::set_winning_region_bounds(WinningRegionBounds bounds) {
+        bounds_ = std::move(bounds);
+        has_bounds_ = true;
+    }
+
+    CUDD::BDD SymbolicCompositionalBestEffortSynthesizer::non_environment_winning_region() const {
+        return non_environment_winning_region_;
+    }
+
+    bool SymbolicCompositionalBestEffortSynthesizer::reenters_initial_state(bool restricted) const {
+        // The restricted arena only exists after the cooperative game
+        if (restricted && arena_.size() < 2) return true;
+
+        const SymbolicStateDfa& arena = arena_[restricted ? 1 : 0];
+        CUDD::BDD into_initial_state = arena.initial_state_bdd().VectorCompose(
+            var_mgr_->make_compose_vector(arena.automaton_id(), arena.transition_function()));
 
-        double t_merge = merge.stop().count() / 1000.0;
-        std::cout << "DONE in " <<  t_merge << " s" << std::endl;
+        return !into_initial_state.IsZero();
     }
 
     std::vector<double> SymbolicCompositionalBestEffortSynthesizer::get_running_times() const {
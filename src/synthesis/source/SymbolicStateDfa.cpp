@@ -1,5 +1,7 @@
 #include "SymbolicStateDfa.h"
 
+#include "CancellationToken.h"
+
 namespace Syft {
 
 SymbolicStateDfa::SymbolicStateDfa(std::shared_ptr<VarMgr> var_mgr)
@@ -77,6 +79,7 @@ std::vector<CUDD::BDD> SymbolicStateDfa::symbolic_transition_function(
       bit_count, var_mgr->cudd_mgr()->bddZero());
 
   for (std::size_t j = 0; j < transition_function.size(); ++j) {
+    CancellationToken::global().check();
     CUDD::BDD state_bdd = state_to_bdd(var_mgr, automaton_id, j);
 
     for (std::size_t i = 0; i < bit_count; ++i) {
@@ -0,0 +1,671 @@
+#include "SynthesisDaemon.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "BestEffortTransducer.h"
+#include "CancellationToken.h"
+#include "Stopwatch.h"
+
+namespace Syft {
+
+namespace {
+
+// The protocol only needs flat objects whose arrays hold strings
+struct JsonValue {
+  enum class Kind {String, Number, Boolean, Null, Array};
+
+  Kind kind = Kind::Null;
+  std::string text;
+  double number = 0;
+  bool boolean = false;
+  std::vector<std::string> items;
+  // Source text of the value, to echo the request id unchanged
+  std::string raw;
+};
+
+std::runtime_error syntax_error(std::size_t position) {
+  return std::runtime_error("Error: Malformed request at character " +
+                            std::to_string(position));
+}
+
+void skip_whitespace(const std::string& text, std::size_t& position) {
+  while (position < text.size() &&
+         (text[position] == ' ' || text[position] == '\t' ||
+          text[position] == '\r' || text[position] == '\n')) {
+    ++position;
+  }
+}
+
+void expect(const std::string& text, std::size_t& position, char c) {
+  skip_whitespace(text, position);
+
+  if (position >= text.size() || text[position] != c) {
+    throw syntax_error(position);
+  }
+
+  ++position;
+}
+
+void append_utf8(std::string& text, unsigned code_point) {
+  if (code_point < 0x80) {
+    text += static_cast<char>(code_point);
+  } else if (code_point < 0x800) {
+    text += static_cast<char>(0xC0 | (code_point >> 6));
+    text += static_cast<char>(0x80 | (code_point & 0x3F));
+  } else {
+    text += static_cast<char>(0xE0 | (code_point >> 12));
+    text += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    text += static_cast<char>(0x80 | (code_point & 0x3F));
+  }
+}
+
+std::string parse_string(const std::string& text, std::size_t& position) {
+  expect(text, position, '"');
+  std::string value;
+
+  while (true) {
+    if (position >= text.size()) {
+      throw syntax_error(position);
+    }
+
+    char c = text[position++];
+
+    if (c == '"') {
+      return value;
+    } else if (c != '\\') {
+      value += c;
+      continue;
+    }
+
+    if (position >= text.size()) {
+      throw syntax_error(position);
+    }
+
+    char escaped = text[position++];
+
+    switch (escaped) {
+      case '"': value += '"'; break;
+      case '\\': value += '\\'; break;
+      case '/': value += '/'; break;
+      case 'b': value += '\b'; break;
+      case 'f': value += '\f'; break;
+      case 'n': value += '\n'; break;
+      case 'r': value += '\r'; break;
+      case 't': value += '\t'; break;
+      case 'u': {
+        if (position + 4 > text.size()) {
+          throw syntax_error(position);
+        }
+
+        std::string digits = text.substr(position, 4);
+
+        if (digits.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos) {
+          throw syntax_error(position);
+        }
+
+        append_utf8(value, std::stoul(digits, nullptr, 16));
+        position += 4;
+        break;
+      }
+      default:
+        throw syntax_error(position - 1);
+    }
+  }
+}
+
+JsonValue parse_value(const std::string& text, std::size_t& position) {
+  skip_whitespace(text, position);
+
+  if (position >= text.size()) {
+    throw syntax_error(position);
+  }
+
+  JsonValue value;
+  std::size_t start = position;
+  char c = text[position];
+
+  if (c == '"') {
+    value.kind = JsonValue::Kind::String;
+    value.text = parse_string(text, position);
+  } else if (c == '[') {
+    value.kind = JsonValue::Kind::Array;
+    ++position;
+    skip_whitespace(text, position);
+
+    if (position < text.size() && text[position] == ']') {
+      ++position;
+    } else {
+      while (true) {
+        skip_whitespace(text, position);
+
+        if (position >= text.size() || text[position] != '"') {
+          throw std::runtime_error("Error: Arrays of a request must hold strings");
+        }
+
+        value.items.push_back(parse_string(text, position));
+        skip_whitespace(text, position);
+
+        if (position < text.size() && text[position] == ',') {
+          ++position;
+        } else {
+          expect(text, position, ']');
+          break;
+        }
+      }
+    }
+  } else if (text.compare(position, 4, "true") == 0) {
+    value.kind = JsonValue::Kind::Boolean;
+    value.boolean = true;
+    position += 4;
+  } else if (text.compare(position, 5, "false") == 0) {
+    value.kind = JsonValue::Kind::Boolean;
+    position += 5;
+  } else if (text.compare(position, 4, "null") == 0) {
+    position += 4;
+  } else {
+    std::size_t end = text.find_first_not_of("+-0123456789.eE", position);
+
+    if (end == std::string::npos) {
+      end = text.size();
+    }
+
+    if (end == position) {
+      throw syntax_error(position);
+    }
+
+    value.kind = JsonValue::Kind::Number;
+
+    try {
+      value.number = std::stod(text.substr(position, end - position));
+    } catch (const std::logic_error&) {
+      throw syntax_error(position);
+    }
+
+    position = end;
+  }
+
+  value.raw = text.substr(start, position - start);
+  return value;
+}
+
+std::map<std::string, JsonValue> parse_object(const std::string& text) {
+  std::map<std::string, JsonValue> fields;
+  std::size_t position = 0;
+  expect(text, position, '{');
+  skip_whitespace(text, position);
+
+  if (position < text.size() && text[position] == '}') {
+    ++position;
+  } else {
+    while (true) {
+      std::string name = parse_string(text, position);
+      expect(text, position, ':');
+      fields[name] = parse_value(text, position);
+      skip_whitespace(text, position);
+
+      if (position < text.size() && text[position] == ',') {
+        ++position;
+      } else {
+        expect(text, position, '}');
+        break;
+      }
+    }
+  }
+
+  skip_whitespace(text, position);
+
+  if (position != text.size()) {
+    throw syntax_error(position);
+  }
+
+  return fields;
+}
+
+const JsonValue& field(const std::map<std::string, JsonValue>& fields,
+                       const std::string& name,
+                       JsonValue::Kind kind,
+                       const std::string& kind_name) {
+  auto found = fields.find(name);
+
+  if (found == fields.end()) {
+    throw std::runtime_error("Error: Request has no field " + name);
+  }
+
+  if (found->second.kind != kind) {
+    throw std::runtime_error("Error: Field " + name + " of a request must be " +
+                             kind_name);
+  }
+
+  return found->second;
+}
+
+std::string escape(const std::string& text) {
+  std::string escaped = "\"";
+
+  for (char c : text) {
+    if (c == '"') {
+      escaped += "\\\"";
+    } else if (c == '\\') {
+      escaped += "\\\\";
+    } else if (c == '\n') {
+      escaped += "\\n";
+    } else if (c == '\r') {
+      escaped += "\\r";
+    } else if (c == '\t') {
+      escaped += "\\t";
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char code[7];
+      std::snprintf(code, sizeof(code), "\\u%04x", c);
+      escaped += code;
+    } else {
+      escaped += c;
+    }
+  }
+
+  return escaped + "\"";
+}
+
+std::string join_sorted(std::vector<std::string> names) {
+  std::sort(names.begin(), names.end());
+  std::string joined;
+
+  for (const std::string& name : names) {
+    joined += name + " ";
+  }
+
+  return joined;
+}
+
+bool write_all(int fd, const std::string& text) {
+  std::size_t written = 0;
+
+  while (written < text.size()) {
+    // A client that hangs up must not kill the daemon with SIGPIPE
+    ssize_t n = send(fd, text.data() + written, text.size() - written,
+                     MSG_NOSIGNAL);
+
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+
+    if (n <= 0) {
+      return false;
+    }
+
+    written += n;
+  }
+
+  return true;
+}
+
+}
+
+SynthesisDaemon::SynthesisDaemon(StrategyExtractionOptions extraction_options,
+                                 double default_timeout,
+                                 DontCareMinimization minimization,
+                                 std::size_t max_sessions,
+                                 std::size_t max_cached_dfas)
+    : extraction_options_(extraction_options)
+    , default_timeout_(default_timeout)
+    , minimization_(minimization)
+    , max_sessions_(max_sessions)
+    , max_cached_dfas_(max_cached_dfas)
+    , request_count_(0) {}
+
+SynthesisSession& SynthesisDaemon::session(const InputOutputPartition& partition,
+                                           Player starting_player,
+                                           bool fresh) {
+  // Requests listing the same variables in another order share a session
+  std::string partition_key = join_sorted(partition.input_variables) + "| " +
+      join_sorted(partition.output_variables);
+  std::pair<std::string, Player> key = std::make_pair(partition_key, starting_player);
+  auto found = sessions_.find(key);
+
+  // A session is only replaced before a new problem, since added conjuncts
+  // refine the last one
+  if (found != sessions_.end() && fresh && max_cached_dfas_ > 0 &&
+      found->second.session->cached_dfa_count() >= max_cached_dfas_) {
+    std::cout << "[BeSyft] Session restarted after caching "
+              << found->second.session->cached_dfa_count() << " DFAs" << std::endl;
+    sessions_.erase(found);
+    found = sessions_.end();
+  }
+
+  if (found == sessions_.end()) {
+    if (max_sessions_ > 0 && sessions_.size() >= max_sessions_) {
+      auto least_recent = std::min_element(
+          sessions_.begin(), sessions_.end(),
+          [](const auto& lhs, const auto& rhs) {
+            return lhs.second.last_request < rhs.second.last_request;
+          });
+      sessions_.erase(least_recent);
+    }
+
+    std::unique_ptr<SynthesisSession> created(
+        new SynthesisSession(partition, starting_player, extraction_options_));
+    found = sessions_.emplace(key, WarmSession{std::move(created), 0}).first;
+  }
+
+  found->second.last_request = request_count_;
+  return *found->second.session;
+}
+
+std::string SynthesisDaemon::handle(const std::string& request) {
+  ++request_count_;
+  Stopwatch latency;
+  latency.start();
+  std::string id = "null";
+  std::ostringstream response;
+
+  try {
+    std::map<std::string, JsonValue> fields = parse_object(request);
+
+    if (fields.find("id") != fields.end()) {
+      id = fields.at("id").raw;
+    }
+
+    // A request with "add_goal" or "add_assumption" extends the last problem
+    // of its session instead of stating a new one
+    bool adds_goal = fields.find("add_goal") != fields.end();
+    bool adds_assumption = fields.find("add_assumption") != fields.end();
+
+    if (adds_goal && adds_assumption) {
+      throw std::runtime_error("Error: A request can add a goal or an assumption conjunct, not both");
+    }
+
+    std::string goal;
+    std::string conjunct;
+
+    if (adds_goal) {
+      conjunct =
+          field(fields, "add_goal", JsonValue::Kind::String, "a string").text;
+    } else if (adds_assumption) {
+      conjunct =
+          field(fields, "add_assumption", JsonValue::Kind::String, "a string").text;
+    } else {
+      goal = field(fields, "goal", JsonValue::Kind::String, "a string").text;
+    }
+
+    std::string assumption = "true";
+
+    if (fields.find("assumption") != fields.end()) {
+      assumption =
+          field(fields, "assumption", JsonValue::Kind::String, "a string").text;
+    }
+
+    InputOutputPartition partition;
+
+    if (fields.find("partition") != fields.end()) {
+      partition = InputOutputPartition::read_from_file(
+          field(fields, "partition", JsonValue::Kind::String, "a string").text);
+    } else {
+      partition.input_variables =
+          field(fields, "inputs", JsonValue::Kind::Array, "an array").items;
+      partition.output_variables =
+          field(fields, "outputs", JsonValue::Kind::Array, "an array").items;
+    }
+
+    Player starting_player = Player::Environment;
+
+    if (fields.find("starting_player") != fields.end()) {
+      std::string player =
+          field(fields, "starting_player", JsonValue::Kind::String, "a string").text;
+
+      if (player == "agent") {
+        starting_player = Player::Agent;
+      } else if (player != "environment") {
+        throw std::runtime_error("Error: Unknown starting player " + player);
+      }
+    }
+
+    bool return_strategy = fields.find("strategy") != fields.end() &&
+        field(fields, "strategy", JsonValue::Kind::Boolean, "a boolean").boolean;
+    double timeout = default_timeout_;
+
+    if (fields.find("timeout") != fields.end()) {
+      timeout = field(fields, "timeout", JsonValue::Kind::Number, "a number").number;
+    }
+
+    SynthesisSession& warm_session =
+        session(partition, starting_player, !adds_goal && !adds_assumption);
+
+    std::vector<double> running_times;
+    std::string verdict;
+    std::string strategy;
+
+    if (timeout > 0) {
+      CancellationToken::global().set_deadline(timeout);
+    }
+
+    try {
+      std::pair<SynthesisResult, SynthesisResult> result =
+          adds_goal ? warm_session.add_goal_conjunct(conjunct) :
+          adds_assumption ? warm_session.add_assumption_conjunct(conjunct) :
+          warm_session.run(goal, assumption);
+      running_times = warm_session.get_running_times();
+
+      if (result.first.realizability) {
+        verdict = "Adv";
+      } else if (result.second.realizability) {
+        verdict = "Coop";
+      } else {
+        verdict = "Unr";
+      }
+
+      if (return_strategy && verdict != "Unr") {
+        if (!result.first.transducer || !result.second.transducer) {
+          throw std::runtime_error("Error: No strategy to return, since output functions are not extracted");
+        }
+
+        BestEffortTransducer transducer(result.first, result.second);
+        transducer.minimize(minimization_);
+        std::ostringstream circuit;
+        transducer.to_aig().write_ascii(circuit);
+        strategy = circuit.str();
+      }
+    } catch (const SynthesisTimeout& timed_out) {
+      running_times = timed_out.running_times();
+      verdict = "TIMEOUT";
+    }
+
+    CancellationToken::global().clear_deadline();
+
+    double total = 0;
+    response << "{\"id\":" << id << ",\"verdict\":\"" << verdict
+             << "\",\"times\":[";
+
+    for (std::size_t i = 0; i < running_times.size(); ++i) {
+      total += running_times[i];
+      response << (i > 0 ? "," : "") << running_times[i];
+    }
+
+    response << "],\"total\":" << total
+             << ",\"cached_dfas\":" << warm_session.cached_dfa_count();
+
+    if (return_strategy) {
+      response << ",\"strategy\":" << (strategy.empty() ? "null" : escape(strategy));
+    }
+
+    response << "}";
+    std::cout << "[BeSyft] Request " << request_count_ << ": " << verdict
+              << " in " << latency.stop().count() / 1000.0 << " s" << std::endl;
+  } catch (const std::exception& exception) {
+    CancellationToken::global().clear_deadline();
+    response.str("");
+    response << "{\"id\":" << id << ",\"error\":" << escape(exception.what())
+             << "}";
+    std::cout << "[BeSyft] Request " << request_count_ << " failed: "
+              << exception.what() << std::endl;
+  }
+
+  return response.str();
+}
+
+void SynthesisDaemon::serve(std::istream& in, std::ostream& out) {
+  std::string line;
+
+  while (!CancellationToken::global().cancel_requested() &&
+         std::getline(in, line)) {
+    if (line.find_first_not_of(" \t\r") == std::string::npos) {
+      continue;
+    }
+
+    out << handle(line) << std::endl;
+  }
+}
+
+void SynthesisDaemon::serve_socket(const std::string& path) {
+  sockaddr_un address;
+  std::memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+
+  if (path.size() >= sizeof(address.sun_path)) {
+    throw std::runtime_error("Error: Socket path is too long: " + path);
+  }
+
+  std::strcpy(address.sun_path, path.c_str());
+  int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+
+  if (listener < 0) {
+    throw std::runtime_error("Error: Cannot create a socket");
+  }
+
+  unlink(path.c_str());
+
+  if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+      listen(listener, 16) != 0) {
+    close(listener);
+    throw std::runtime_error("Error: Cannot listen on " + path);
+  }
+
+  std::cout << "[BeSyft] Listening on " << path << std::endl;
+
+  struct Connection {
+    int fd;
+    // Received text not yet answered
+    std::string pending;
+    // Whether the client stopped sending. Its queued requests are still answered
+    bool finished;
+    bool closed;
+  };
+
+  std::vector<Connection> connections;
+  char buffer[4096];
+
+  while (!CancellationToken::global().cancel_requested()) {
+    std::vector<pollfd> polled = {{listener, POLLIN, 0}};
+    std::vector<std::size_t> positions;
+    bool queued = false;
+
+    for (std::size_t i = 0; i < connections.size(); ++i) {
+      if (!connections[i].finished) {
+        polled.push_back({connections[i].fd, POLLIN, 0});
+        positions.push_back(i);
+      }
+
+      queued = queued || connections[i].pending.find('\n') != std::string::npos;
+    }
+
+    // Unlike read, poll is not restarted after a signal, so cancellation is
+    // noticed while the clients are idle. Queued requests are answered
+    // without waiting.
+    if (poll(polled.data(), polled.size(), queued ? 0 : -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+
+      break;
+    }
+
+    if (polled[0].revents != 0) {
+      int fd = accept(listener, nullptr, nullptr);
+
+      if (fd >= 0) {
+        connections.push_back({fd, "", false, false});
+      }
+    }
+
+    for (std::size_t j = 0; j < positions.size(); ++j) {
+      if (polled[j + 1].revents == 0) {
+        continue;
+      }
+
+      Connection& connection = connections[positions[j]];
+      ssize_t n = read(connection.fd, buffer, sizeof(buffer));
+
+      if (n > 0) {
+        connection.pending.append(buffer, n);
+      } else if (n == 0 || errno != EINTR) {
+        connection.finished = true;
+      }
+    }
+
+    // One request per connection and round, so a client sending many
+    // requests at once does not starve the others
+    for (Connection& connection : connections) {
+      std::size_t end;
+
+      while (!connection.closed &&
+             (end = connection.pending.find('\n')) != std::string::npos) {
+        std::string line = connection.pending.substr(0, end);
+        connection.pending.erase(0, end + 1);
+
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+          continue;
+        }
+
+        if (!write_all(connection.fd, handle(line) + "\n")) {
+          connection.closed = true;
+        }
+
+        break;
+      }
+
+      if (connection.finished &&
+          connection.pending.find('\n') == std::string::npos) {
+        connection.closed = true;
+      }
+    }
+
+    std::vector<Connection> remaining;
+
+    for (Connection& connection : connections) {
+      if (connection.closed) {
+        close(connection.fd);
+      } else {
+        remaining.push_back(std::move(connection));
+      }
+    }
+
+    connections.swap(remaining);
+  }
+
+  for (const Connection& connection : connections) {
+    close(connection.fd);
+  }
+
+  close(listener);
+  unlink(path.c_str());
+}
+
+std::size_t SynthesisDaemon::request_count() const {
+  return request_count_;
+}
+
+std::size_t SynthesisDaemon::session_count() const {
+  return sessions_.size();
+}
+
+}
@@ -0,0 +1,322 @@
+#include "SynthesisSession.h"
+
+#include <iostream>
+#include <set>
+#include <stdexcept>
+
+#include "CancellationToken.h"
+#include "Stopwatch.h"
+
+namespace Syft {
+
+SynthesisSession::SynthesisSession(const InputOutputPartition& partition,
+                                   Player starting_player,
+                                   StrategyExtractionOptions extraction_options)
+    : var_mgr_(std::make_shared<VarMgr>())
+    , starting_player_(starting_player)
+    , extraction_options_(extraction_options)
+    , hit_count_(0)
+    , miss_count_(0)
+    , solved_(false)
+    , adversarial_fixpoint_(false)
+    , cooperative_fixpoint_(false)
+    , reenters_initial_state_(true)
+    , reenters_restricted_initial_state_(true) {
+  // Variables are created once for the whole session, in partition order,
+  // since a VarMgr accepts a single partition
+  partition_variables_.insert(partition.input_variables.begin(),
+                              partition.input_variables.end());
+  partition_variables_.insert(partition.output_variables.begin(),
+                              partition.output_variables.end());
+  var_mgr_->create_named_variables(partition.input_variables);
+  var_mgr_->create_named_variables(partition.output_variables);
+  var_mgr_->partition_variables(partition.input_variables,
+                                partition.output_variables);
+}
+
+double SynthesisSession::translate(const std::vector<std::string>& formulas) {
+  std::vector<std::string> new_formulas;
+  std::vector<ExplicitStateDfaMona> new_mona_dfas;
+
+  Stopwatch ltlf2dfa;
+  ltlf2dfa.start();
+
+  for (const std::string& formula : formulas) {
+    bool pending = false;
+
+    for (const std::string& new_formula : new_formulas) {
+      pending = pending || new_formula == formula;
+    }
+
+    if (dfas_.find(formula) != dfas_.end() || pending) {
+      ++hit_count_;
+      continue;
+    }
+
+    ++miss_count_;
+    ExplicitStateDfaMona mona_dfa = ExplicitStateDfaMona::dfa_of_formula(formula);
+
+    for (const std::string& name : mona_dfa.names) {
+      if (partition_variables_.find(name) == partition_variables_.end()) {
+        throw std::runtime_error("Error: Variable " + name + " of formula " +
+                                 formula + " is not in the partition");
+      }
+    }
+
+    new_formulas.push_back(formula);
+    new_mona_dfas.push_back(mona_dfa);
+  }
+
+  double t_ltlf2dfa = ltlf2dfa.stop().count() / 1000.0;
+  running_times_.push_back(t_ltlf2dfa);
+  std::cout << "[BeSyft] MONA DFA construction DONE in: " << t_ltlf2dfa
+            << " s (" << new_formulas.size() << " of " << formulas.size()
+            << " DFAs translated)" << std::endl;
+
+  Stopwatch dfa2sym;
+  dfa2sym.start();
+
+  for (std::size_t i = 0; i < new_formulas.size(); ++i) {
+    ExplicitStateDfa explicit_dfa =
+        ExplicitStateDfa::from_dfa_mona(var_mgr_, new_mona_dfas[i]);
+    SymbolicStateDfa symbolic_dfa = SymbolicStateDfa::from_explicit(explicit_dfa);
+    dfas_.emplace(new_formulas[i],
+                  CachedDfa{new_mona_dfas[i], explicit_dfa, symbolic_dfa});
+  }
+
+  return dfa2sym.stop().count() / 1000.0;
+}
+
+SymbolicStateDfa SynthesisSession::component_dfa(
+    const std::string& formula,
+    std::set<std::size_t>& used_automata) {
+  const CachedDfa& cached = dfas_.at(formula);
+
+  // A formula occurring twice in a product, e.g. the assumption "true",
+  // needs separate state variables for each copy
+  if (used_automata.find(cached.symbolic_dfa.automaton_id()) == used_automata.end()) {
+    used_automata.insert(cached.symbolic_dfa.automaton_id());
+    return cached.symbolic_dfa;
+  }
+
+  SymbolicStateDfa copy = SymbolicStateDfa::from_explicit(cached.explicit_dfa);
+  used_automata.insert(copy.automaton_id());
+  return copy;
+}
+
+std::pair<SynthesisResult, SynthesisResult> SynthesisSession::solve(
+    double conversion_time,
+    const WinningRegionBounds* bounds) {
+  Stopwatch dfa2sym;
+  dfa2sym.start();
+
+  SymbolicStateDfa agent_dfa = goal_dfas_.size() == 1 ?
+      goal_dfas_[0] : SymbolicStateDfa::product(goal_dfas_);
+  SymbolicStateDfa environment_dfa = assumption_dfas_.size() == 1 ?
+      assumption_dfas_[0] : SymbolicStateDfa::product(assumption_dfas_);
+
+  SymbolicCompositionalBestEffortSynthesizer synthesizer(
+      var_mgr_,
+      agent_dfa,
+      environment_dfa,
+      tautology_dfa_[0],
+      starting_player_,
+      extraction_options_);
+
+  if (bounds) {
+    synthesizer.set_winning_region_bounds(*bounds);
+  }
+
+  double t_dfa2sym = conversion_time + dfa2sym.stop().count() / 1000.0;
+  running_times_.push_back(t_dfa2sym);
+  std::cout << "[BeSyft] Symbolic DFA construction DONE in " << t_dfa2sym
+            << " s" << std::endl;
+
+  std::pair<SynthesisResult, SynthesisResult> result = synthesizer.run();
+  std::vector<double> game_times = synthesizer.get_running_times();
+  running_times_.insert(running_times_.end(), game_times.begin(), game_times.end());
+
+  // The games stop as soon as the initial state is winning, so only the
+  // regions of unrealizable games are complete
+  last_regions_.adversarial = result.first.winning_states;
+  last_regions_.cooperative = result.second.winning_states;
+  last_regions_.non_environment = synthesizer.non_environment_winning_region();
+  adversarial_fixpoint_ = !result.first.realizability;
+  cooperative_fixpoint_ = !result.second.realizability;
+  reenters_initial_state_ = synthesizer.reenters_initial_state(false);
+  reenters_restricted_initial_state_ = synthesizer.reenters_initial_state(true);
+
+  return result;
+}
+
+void SynthesisSession::check_last_problem() const {
+  if (!solved_) {
+    throw std::runtime_error("Error: No solved problem to add a conjunct to");
+  }
+}
+
+std::pair<SynthesisResult, SynthesisResult> SynthesisSession::run(
+    const std::string& agent_specification,
+    const std::string& environment_assumption) {
+  running_times_.clear();
+  // Conjuncts are only added to a problem whose games were solved
+  solved_ = false;
+
+  RunningTimesScope running_times_scope(running_times_);
+
+  // A_{phi}, A_{E} and A_{tt}, which accepts non-empty traces only
+  double conversion_time =
+      translate({agent_specification, environment_assumption, "true"});
+
+  Stopwatch dfa2sym;
+  dfa2sym.start();
+
+  std::set<std::size_t> used_automata;
+  goal_dfas_ = {component_dfa(agent_specification, used_automata)};
+  assumption_dfas_ = {component_dfa(environment_assumption, used_automata)};
+  tautology_dfa_ = {component_dfa("true", used_automata)};
+  goal_conjuncts_ = {agent_specification};
+  assumption_conjuncts_ = {environment_assumption};
+  conversion_time += dfa2sym.stop().count() / 1000.0;
+
+  std::pair<SynthesisResult, SynthesisResult> result =
+      solve(conversion_time, nullptr);
+  solved_ = true;
+
+  return result;
+}
+
+std::pair<SynthesisResult, SynthesisResult> SynthesisSession::add_goal_conjunct(
+    const std::string& conjunct) {
+  check_last_problem();
+  running_times_.clear();
+
+  RunningTimesScope running_times_scope(running_times_);
+
+  double conversion_time = translate({conjunct});
+
+  Stopwatch dfa2sym;
+  dfa2sym.start();
+
+  std::set<std::size_t> used_automata;
+
+  for (const std::vector<SymbolicStateDfa>* dfas :
+           {&goal_dfas_, &assumption_dfas_, &tautology_dfa_}) {
+    for (const SymbolicStateDfa& dfa : *dfas) {
+      used_automata.insert(dfa.automaton_id());
+    }
+  }
+
+  SymbolicStateDfa conjunct_dfa = component_dfa(conjunct, used_automata);
+  conversion_time += dfa2sym.stop().count() / 1000.0;
+
+  // The regions of the last arena are over a subset of the state variables
+  // of the new one, and bound its regions: a state of the new arena wins
+  // only if its projection on the last arena wins. A re-entered initial
+  // state breaks this, since initial states are excluded from the goals
+  bool bound_adversarial = adversarial_fixpoint_ && !reenters_initial_state_;
+  bool bound_cooperative = cooperative_fixpoint_ && !reenters_restricted_initial_state_;
+  WinningRegionBounds bounds;
+  bounds.adversarial = bound_adversarial ?
+      last_regions_.adversarial : var_mgr_->cudd_mgr()->bddOne();
+  bounds.cooperative = bound_cooperative ?
+      last_regions_.cooperative : var_mgr_->cudd_mgr()->bddOne();
+  bounds.non_environment = last_regions_.non_environment;
+  bounds.reuse_non_environment = !reenters_initial_state_;
+
+  std::cout << "[BeSyft] Goal conjunct " << conjunct
+            << " added. Adversarial game bounded: "
+            << (bound_adversarial ? "yes" : "no")
+            << ", cooperative game bounded: "
+            << (bound_cooperative ? "yes" : "no") << std::endl;
+
+  // A conjunct that fails to translate leaves the last problem as it was
+  solved_ = false;
+  goal_dfas_.push_back(conjunct_dfa);
+  goal_conjuncts_.push_back(conjunct);
+  std::pair<SynthesisResult, SynthesisResult> result =
+      solve(conversion_time, &bounds);
+  solved_ = true;
+
+  return result;
+}
+
+std::pair<SynthesisResult, SynthesisResult> SynthesisSession::add_assumption_conjunct(
+    const std::string& conjunct) {
+  check_last_problem();
+  running_times_.clear();
+
+  RunningTimesScope running_times_scope(running_times_);
+
+  double conversion_time = translate({conjunct});
+
+  Stopwatch dfa2sym;
+  dfa2sym.start();
+
+  std::set<std::size_t> used_automata;
+
+  for (const std::vector<SymbolicStateDfa>* dfas :
+           {&goal_dfas_, &assumption_dfas_, &tautology_dfa_}) {
+    for (const SymbolicStateDfa& dfa : *dfas) {
+      used_automata.insert(dfa.automaton_id());
+    }
+  }
+
+  SymbolicStateDfa conjunct_dfa = component_dfa(conjunct, used_automata);
+  conversion_time += dfa2sym.stop().count() / 1000.0;
+
+  std::cout << "[BeSyft] Assumption conjunct " << conjunct << " added"
+            << std::endl;
+
+  // A conjunct that fails to translate leaves the last problem as it was
+  solved_ = false;
+  assumption_dfas_.push_back(conjunct_dfa);
+  assumption_conjuncts_.push_back(conjunct);
+  std::pair<SynthesisResult, SynthesisResult> result =
+      solve(conversion_time, nullptr);
+  solved_ = true;
+
+  return result;
+}
+
+std::string SynthesisSession::agent_specification() const {
+  std::string conjunction;
+
+  for (const std::string& conjunct : goal_conjuncts_) {
+    conjunction += (conjunction.empty() ? "(" : " && (") + conjunct + ")";
+  }
+
+  return conjunction;
+}
+
+std::string SynthesisSession::environment_assumption() const {
+  std::string conjunction;
+
+  for (const std::string& conjunct : assumption_conjuncts_) {
+    conjunction += (conjunction.empty() ? "(" : " && (") + conjunct + ")";
+  }
+
+  return conjunction;
+}
+
+std::vector<double> SynthesisSession::get_running_times() const {
+  return running_times_;
+}
+
+std::shared_ptr<VarMgr> SynthesisSession::var_mgr() const {
+  return var_mgr_;
+}
+
+std::size_t SynthesisSession::cached_dfa_count() const {
+  return dfas_.size();
+}
+
+std::size_t SynthesisSession::hit_count() const {
+  return hit_count_;
+}
+
+std::size_t SynthesisSession::miss_count() const {
+  return miss_count_;
+}
+
+}
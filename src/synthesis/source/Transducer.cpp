@@ -2,41 +2,261 @@
 
 #include <cstring>
 #include <iostream>
+#include <stdexcept>
 
 namespace Syft {
 
+namespace {
+
+Aig::Literal bdd_to_aig(DdNode* node,
+                        const std::vector<Aig::Literal>& variable_literals,
+                        std::unordered_map<DdNode*, Aig::Literal>& literals,
+                        Aig& aig) {
+  Aig::Literal complement = Cudd_IsComplement(node) ? 1 : 0;
+  DdNode* regular = Cudd_Regular(node);
+
+  if (Cudd_IsConstant(regular)) {
+    return Aig::true_literal ^ complement;
+  }
+
+  auto found = literals.find(regular);
+
+  if (found != literals.end()) {
+    return found->second ^ complement;
+  }
+
+  Aig::Literal then_literal =
+      bdd_to_aig(Cudd_T(regular), variable_literals, literals, aig);
+  Aig::Literal else_literal =
+      bdd_to_aig(Cudd_E(regular), variable_literals, literals, aig);
+  Aig::Literal literal =
+      aig.make_mux(variable_literals[Cudd_NodeReadIndex(regular)],
+                   then_literal, else_literal);
+  literals.emplace(regular, literal);
+
+  return literal ^ complement;
+}
+
+}
+
 Transducer::Transducer(std::shared_ptr<VarMgr> var_mgr,
+                       std::size_t automaton_id,
                        std::vector<int> initial_vector,
                        std::unordered_map<int, CUDD::BDD> output_function,
                        std::vector<CUDD::BDD> transition_function,
                        Player starting_player,
                        Player protagonist_player)
     : var_mgr_(std::move(var_mgr))
+    , automaton_id_(automaton_id)
     , initial_vector_(std::move(initial_vector))
-    , output_function_(std::move(output_function))
     , transition_function_(std::move(transition_function))
     , starting_player_(starting_player)
-    , protagonist_player_(protagonist_player)
-{}
+    , protagonist_player_(protagonist_player) {
+  // Labels are looked up once, so that the functions can be accessed by
+  // position afterwards
+  for (const std::string& label : output_labels()) {
+    int index = var_mgr_->name_to_variable(label).NodeReadIndex();
+    output_indices_.push_back(index);
+    output_function_.push_back(output_function.at(index));
+  }
+}
+
+std::vector<std::string> Transducer::output_labels() const {
+  if (protagonist_player_ == Player::Environment) {
+    return var_mgr_->input_variable_labels();
+  } else {
+    return var_mgr_->output_variable_labels();
+  }
+}
+
+std::vector<std::string> Transducer::input_labels() const {
+  if (protagonist_player_ == Player::Environment) {
+    return var_mgr_->output_variable_labels();
+  } else {
+    return var_mgr_->input_variable_labels();
+  }
+}
+
+const std::vector<int>& Transducer::output_indices() const {
+  return output_indices_;
+}
+
+const std::vector<CUDD::BDD>& Transducer::output_functions() const {
+  return output_function_;
+}
+
+CUDD::BDD Transducer::output_function(int index) const {
+  for (std::size_t i = 0; i < output_indices_.size(); ++i) {
+    if (output_indices_[i] == index) {
+      return output_function_[i];
+    }
+  }
+
+  throw std::runtime_error("Error: Transducer has no output function for variable " +
+                           std::to_string(index));
+}
 
 void Transducer::dump_dot(const std::string& filename) const {
-	std::vector<std::string> output_labels;
+  std::vector<CUDD::ADD> output_vector;
 
-	if (protagonist_player_ == Player::Environment) {
-    output_labels = var_mgr_->input_variable_labels();
-	} else {
-		output_labels = var_mgr_->output_variable_labels();
-	}
+  for (const CUDD::BDD& function : output_function_) {
+    output_vector.push_back(function.Add());
+  }
 
-  std::size_t output_count = output_function_.size();
-  std::vector<CUDD::ADD> output_vector(output_count);
+  var_mgr_->dump_dot(output_vector, output_labels(), filename);
+}
+
+Aig Transducer::to_aig() const {
+  Aig aig;
+  std::vector<Aig::Literal> variable_literals(var_mgr_->total_variable_count(),
+                                              Aig::false_literal);
 
-  for (std::size_t i = 0; i < output_count; ++i) {
-    std::string label = output_labels[i];
+  for (const std::string& label : input_labels()) {
     int index = var_mgr_->name_to_variable(label).NodeReadIndex();
-    output_vector[i] = output_function_.at(index).Add();
+    variable_literals[index] = aig.add_input(label);
+  }
+
+  std::vector<std::string> state_labels =
+      var_mgr_->state_variable_labels(automaton_id_);
+
+  for (std::size_t i = 0; i < state_labels.size(); ++i) {
+    int index = var_mgr_->state_variable(automaton_id_, i).NodeReadIndex();
+    variable_literals[index] =
+        aig.add_latch(state_labels[i], initial_vector_[index] != 0);
+  }
+
+  // Output functions do not depend on outputs, so the nodes converted for
+  // them stay valid once the outputs are bound to their literals
+  std::unordered_map<DdNode*, Aig::Literal> literals;
+  std::vector<std::string> labels = output_labels();
+
+  for (std::size_t i = 0; i < output_function_.size(); ++i) {
+    Aig::Literal literal = bdd_to_aig(output_function_[i].getNode(),
+                                      variable_literals, literals, aig);
+    variable_literals[output_indices_[i]] = literal;
+    aig.add_output(labels[i], literal);
+  }
+
+  for (std::size_t i = 0; i < transition_function_.size(); ++i) {
+    aig.set_latch_next(i, bdd_to_aig(transition_function_[i].getNode(),
+                                     variable_literals, literals, aig));
+  }
+
+  return aig;
+}
+
+void Transducer::dump_aiger(const std::string& filename) const {
+  Aig aig = to_aig();
+
+  std::cout << "[BeSyft] AIG: " << aig.and_count() << " AND gates (depth "
+            << aig.depth() << "), " << aig.latch_count() << " latches" << std::endl;
+
+  Aig balanced = aig.balance();
+
+  std::cout << "[BeSyft] Balanced AIG: " << balanced.and_count()
+            << " AND gates (depth " << balanced.depth() << "), "
+            << balanced.latch_count() << " latches" << std::endl;
+
+  std::string binary_extension = ".aig";
+
+  if (filename.size() >= binary_extension.size() &&
+      filename.compare(filename.size() - binary_extension.size(),
+                       binary_extension.size(), binary_extension) == 0) {
+    balanced.write_binary(filename);
+  } else {
+    balanced.write_ascii(filename);
+  }
+}
+
+CUDD::BDD Transducer::reachable_states() const {
+  std::shared_ptr<CUDD::Cudd> mgr = var_mgr_->cudd_mgr();
+  std::size_t state_count = var_mgr_->state_variable_count(automaton_id_);
+  std::size_t next_id = var_mgr_->scratch_state_variables(state_count);
+
+  // Transitions taken when the protagonist follows the output functions
+  std::vector<CUDD::BDD> strategy_vector;
+
+  for (std::size_t i = 0; i < var_mgr_->total_variable_count(); ++i) {
+    strategy_vector.push_back(mgr->bddVar(i));
   }
 
-  var_mgr_->dump_dot(output_vector, output_labels, filename);
+  for (std::size_t i = 0; i < output_indices_.size(); ++i) {
+    strategy_vector[output_indices_[i]] = output_function_[i];
   }
+
+  CUDD::BDD transition_relation = mgr->bddOne();
+  CUDD::BDD current_cube = var_mgr_->input_cube() & var_mgr_->output_cube();
+  CUDD::BDD initial_state = mgr->bddOne();
+  std::vector<CUDD::BDD> rename_vector(strategy_vector.size());
+
+  for (std::size_t i = 0; i < var_mgr_->total_variable_count(); ++i) {
+    rename_vector[i] = mgr->bddVar(i);
+  }
+
+  for (std::size_t i = 0; i < state_count; ++i) {
+    CUDD::BDD current = var_mgr_->state_variable(automaton_id_, i);
+    CUDD::BDD next = var_mgr_->state_variable(next_id, i);
+
+    transition_relation &= next.Xnor(
+        transition_function_[i].VectorCompose(strategy_vector));
+    current_cube &= current;
+    rename_vector[next.NodeReadIndex()] = current;
+
+    if (initial_vector_[current.NodeReadIndex()]) {
+      initial_state &= current;
+    } else {
+      initial_state &= !current;
+    }
+  }
+
+  CUDD::BDD reachable = initial_state;
+
+  while (true) {
+    CUDD::BDD image = reachable.AndAbstract(transition_relation, current_cube)
+        .VectorCompose(rename_vector);
+    CUDD::BDD new_reachable = reachable | image;
+
+    if (new_reachable == reachable) {
+      return reachable;
+    }
+
+    reachable = new_reachable;
+  }
+}
+
+void Transducer::minimize(const CUDD::BDD& winning_states,
+                          DontCareMinimization method) {
+  if (method == DontCareMinimization::None) {
+    return;
+  }
+
+  CUDD::BDD care_set = winning_states & reachable_states();
+  std::vector<std::string> labels = output_labels();
+  int total_before = 0;
+  int total_after = 0;
+
+  for (std::size_t i = 0; i < output_function_.size(); ++i) {
+    CUDD::BDD& function = output_function_[i];
+    int before = function.nodeCount();
+
+    if (method == DontCareMinimization::Restrict) {
+      function = function.Restrict(care_set);
+    } else if (method == DontCareMinimization::LICompaction) {
+      function = function.LICompaction(care_set);
+    } else {
+      function = (function & care_set).Squeeze(function | !care_set);
+    }
+
+    int after = function.nodeCount();
+    total_before += before;
+    total_after += after;
+
+    std::cout << "[BeSyft] Output function of " << labels[i] << ": " << before
+              << " -> " << after << " nodes" << std::endl;
+  }
+
+  std::cout << "[BeSyft] Output functions minimized from " << total_before
+            << " to " << total_after << " nodes" << std::endl;
+}
+
 }
@@ -0,0 +1,172 @@
+#include "TransducerExecutor.h"
+
+#include <limits>
+#include <stdexcept>
+
+namespace Syft {
+
+TransducerExecutor::TransducerExecutor(const Transducer& transducer) {
+  std::shared_ptr<VarMgr> var_mgr = transducer.var_mgr_;
+  std::unordered_map<DdNode*, std::uint32_t> positions;
+
+  nodes_.push_back({std::numeric_limits<std::uint32_t>::max(), 0, 0});
+
+  for (std::size_t i = 0; i < transducer.output_indices_.size(); ++i) {
+    output_indices_.push_back(transducer.output_indices_[i]);
+    output_roots_.push_back(
+        flatten(transducer.output_function_[i].getNode(), positions));
+  }
+
+  for (const CUDD::BDD& bit_function : transducer.transition_function_) {
+    transition_roots_.push_back(flatten(bit_function.getNode(), positions));
+  }
+
+  for (const std::string& label : transducer.input_labels()) {
+    input_indices_.push_back(var_mgr->name_to_variable(label).NodeReadIndex());
+  }
+
+  for (std::size_t i = 0;
+       i < var_mgr->state_variable_count(transducer.automaton_id_); ++i) {
+    std::uint32_t index =
+        var_mgr->state_variable(transducer.automaton_id_, i).NodeReadIndex();
+    state_indices_.push_back(index);
+    initial_state_.push_back(transducer.initial_vector_[index] ? 1 : 0);
+  }
+
+  valuation_.assign(var_mgr->total_variable_count(), 0);
+  next_state_.assign(state_indices_.size(), 0);
+  reset();
+}
+
+std::uint32_t TransducerExecutor::flatten(
+    DdNode* node, std::unordered_map<DdNode*, std::uint32_t>& positions) {
+  std::uint32_t complement = Cudd_IsComplement(node) ? 1 : 0;
+  DdNode* regular = Cudd_Regular(node);
+
+  // The only constant of a BDD is 1, 0 is its complement
+  if (Cudd_IsConstant(regular)) {
+    return complement;
+  }
+
+  auto found = positions.find(regular);
+
+  if (found != positions.end()) {
+    return (found->second << 1) | complement;
+  }
+
+  std::uint32_t then_edge = flatten(Cudd_T(regular), positions);
+  std::uint32_t else_edge = flatten(Cudd_E(regular), positions);
+  std::uint32_t position = nodes_.size();
+
+  nodes_.push_back({Cudd_NodeReadIndex(regular), then_edge, else_edge});
+  positions.emplace(regular, position);
+
+  return (position << 1) | complement;
+}
+
+bool TransducerExecutor::evaluate(std::uint32_t root) const {
+  std::uint32_t edge = root;
+  std::uint32_t complement = 0;
+
+  while ((edge >> 1) != 0) {
+    const Node& node = nodes_[edge >> 1];
+    complement ^= edge & 1;
+    edge = valuation_[node.variable] ? node.then_edge : node.else_edge;
+  }
+
+  return (complement ^ (edge & 1)) == 0;
+}
+
+void TransducerExecutor::reset() {
+  for (std::size_t i = 0; i < state_indices_.size(); ++i) {
+    valuation_[state_indices_[i]] = initial_state_[i];
+  }
+}
+
+void TransducerExecutor::step(const std::uint8_t* input, std::uint8_t* output) {
+  for (std::size_t i = 0; i < input_indices_.size(); ++i) {
+    valuation_[input_indices_[i]] = input[i];
+  }
+
+  // Output functions never depend on other outputs, so they can be written
+  // into the valuation as soon as they are computed
+  for (std::size_t i = 0; i < output_roots_.size(); ++i) {
+    std::uint8_t value = evaluate(output_roots_[i]);
+    valuation_[output_indices_[i]] = value;
+    output[i] = value;
+  }
+
+  for (std::size_t i = 0; i < transition_roots_.size(); ++i) {
+    next_state_[i] = evaluate(transition_roots_[i]);
+  }
+
+  for (std::size_t i = 0; i < state_indices_.size(); ++i) {
+    valuation_[state_indices_[i]] = next_state_[i];
+  }
+}
+
+std::vector<std::uint8_t> TransducerExecutor::run(
+    const std::vector<std::uint8_t>& inputs) {
+  std::size_t input_count = input_indices_.size();
+  std::size_t output_count = output_indices_.size();
+
+  if (input_count == 0) {
+    throw std::runtime_error("Error: Traces cannot be delimited without inputs.");
+  } else if (inputs.size() % input_count != 0) {
+    throw std::invalid_argument(
+        "Error: Trace length is not a multiple of the number of inputs.");
+  }
+
+  std::size_t length = inputs.size() / input_count;
+  std::vector<std::uint8_t> outputs(length * output_count);
+
+  reset();
+
+  for (std::size_t t = 0; t < length; ++t) {
+    step(&inputs[t * input_count], outputs.data() + t * output_count);
+  }
+
+  return outputs;
+}
+
+std::vector<std::vector<std::uint8_t>> TransducerExecutor::run_batch(
+    const std::vector<std::vector<std::uint8_t>>& traces) {
+  std::vector<std::vector<std::uint8_t>> outputs;
+  outputs.reserve(traces.size());
+
+  for (const std::vector<std::uint8_t>& trace : traces) {
+    outputs.push_back(run(trace));
+  }
+
+  return outputs;
+}
+
+std::vector<std::uint8_t> TransducerExecutor::state() const {
+  std::vector<std::uint8_t> current(state_indices_.size());
+
+  for (std::size_t i = 0; i < state_indices_.size(); ++i) {
+    current[i] = valuation_[state_indices_[i]];
+  }
+
+  return current;
+}
+
+void TransducerExecutor::set_state(const std::vector<std::uint8_t>& state) {
+  for (std::size_t i = 0; i < state_indices_.size(); ++i) {
+    valuation_[state_indices_[i]] = state[i];
+  }
+}
+
+std::size_t TransducerExecutor::input_count() const {
+  return input_indices_.size();
+}
+
+std::size_t TransducerExecutor::output_count() const {
+  return output_indices_.size();
+}
+
+std::size_t TransducerExecutor::node_count() const {
+  return nodes_.size();
+}
+
+}
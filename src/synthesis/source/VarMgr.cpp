@@ -1,14 +1,46 @@
 #include "VarMgr.h"
 
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 #include <boost/algorithm/string.hpp>
 #include <iostream>
 
+#include "CancellationToken.h"
+
 namespace Syft {
 
+namespace {
+
+// Termination callback polled by CUDD while building new nodes
+int synthesis_cancelled(const void*) {
+  return CancellationToken::global().poll();
+}
+
+// Operations stopped on cancellation throw a SynthesisTimeout, like every
+// other check point. Those stopped by another callback keep the
+// std::logic_error of the default CUDD handler.
+void handle_termination(std::string message) {
+  if (CancellationToken::global().cancelled()) {
+    throw SynthesisTimeout();
+  }
+
+  throw std::logic_error(message);
+}
+
+}
+
 VarMgr::VarMgr() {
   mgr_ = std::make_shared<CUDD::Cudd>();
+  mgr_->setTerminationHandler(handle_termination);
+  watch_cancellation();
+  has_scratch_state_variables_ = false;
+  scratch_automaton_id_ = 0;
+}
+
+void VarMgr::watch_cancellation() const {
+  Cudd_RegisterTerminationCallback(mgr_->getManager(), synthesis_cancelled,
+                                   nullptr);
 }
 
 void VarMgr::create_named_variables(
@@ -338,5 +370,23 @@ std::size_t VarMgr::copy_state_variables(std::size_t automaton_id) {
 
   return copied_vars_id;
 }
+
+std::size_t VarMgr::scratch_state_variables(std::size_t variable_count) {
+  if (!has_scratch_state_variables_ ||
+      state_variables_[scratch_automaton_id_].size() < variable_count) {
+    // Grow geometrically, so that increasing requests create few groups
+    std::size_t new_count = variable_count;
+
+    if (has_scratch_state_variables_) {
+      new_count = std::max(variable_count,
+                           2 * state_variables_[scratch_automaton_id_].size());
+    }
+
+    scratch_automaton_id_ = create_state_variables(new_count);
+    has_scratch_state_variables_ = true;
+  }
+
+  return scratch_automaton_id_;
+}
   
 }